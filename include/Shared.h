@@ -33,11 +33,12 @@
 #ifndef MCL_SHARED_H
 #define MCL_SHARED_H
 
+#include <atomic>
 #include <cstddef>
 
 namespace MCL
 {
-  extern size_t maxThreads;
+  extern std::atomic<size_t> maxThreads;
 
   typedef double FP_t;
 }
@@ -28,7 +28,9 @@
 //
 // CLASSES INCLUDED:    TVector3D
 //
-// HISTORY:             2018-05-19/GGB - Changed class name to TVector3D.
+// HISTORY:             2026-10-19 GGB - Made constexpr, noexcept and trivially copyable. Added madd().
+//                      2026-10-19 GGB - Corrected cross(). Added vector3DArray_t in vector3DArray.hpp.
+//                      2018-05-19/GGB - Changed class name to TVector3D.
 //                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2012-12-26 GGB - File created.
 //
@@ -37,74 +39,112 @@
 #ifndef MCL_TVECTOR3D_HPP
 #define MCL_TVECTOR3D_HPP
 
+  // Standard C++ library header files.
+
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+  // MCL library header files.
+
+#include "config.h"
 #include "exceptions.h"
+#include "functions.hpp"
 
 namespace MCL
 {
   template<typename T>
   class TVector3D
   {
-    template<typename U>
-    friend TVector3D<U> floor(TVector3D<U> const &);
-
-    template<typename U>
-    friend TVector3D<U> ceil(TVector3D<U> const &);
   private:
-    T value[3];
+    T value[3] = { 0, 0, 0 };
 
   protected:
   public:
-    inline TVector3D() { value[0] = value[1] = value[2] = 0; }
-    inline TVector3D(T const &v1, T const &v2, T const &v3) { value[0] = v1; value[1] = v2; value[2] = v3;}
-    inline TVector3D(TVector3D const &toCopy) { value[0] = toCopy.value[0]; value[1] = toCopy.value[1]; value[2] = toCopy.value[2]; }
+    constexpr TVector3D() noexcept = default;
+    constexpr TVector3D(T const &v1, T const &v2, T const &v3) noexcept : value{ v1, v2, v3 } {}
+    constexpr TVector3D(TVector3D const &) noexcept = default;
+
+    constexpr TVector3D &operator=(TVector3D const &) noexcept = default;
 
-    inline T const &x() const { return value[0];}
-    inline T const &y() const { return value[1];}
-    inline T const &z() const { return value[2];}
+    constexpr T const &x() const noexcept { return value[0];}
+    constexpr T const &y() const noexcept { return value[1];}
+    constexpr T const &z() const noexcept { return value[2];}
 
-    inline T &x() { return value[0];}
-    inline T &y() { return value[1];}
-    inline T &z() { return value[2];}
+    constexpr T &x() noexcept { return value[0];}
+    constexpr T &y() noexcept { return value[1];}
+    constexpr T &z() noexcept { return value[2];}
 
     /// @brief Adds two vectors.
     /// @param[in] rhs: The vector to add to *this.
     /// @returns The sum of *this and rhs
+    /// @version 2026-10-19/GGB - Made constexpr noexcept.
     /// @version 2014-03-13/GGB - Function created.
 
-    inline TVector3D<T> operator +(TVector3D<T> const &rhs) const
+    constexpr TVector3D<T> operator +(TVector3D<T> const &rhs) const noexcept
     {
-      TVector3D<T> result;
-
-      result.value[0] = value[0] + rhs.value[0];
-      result.value[1] = value[1] + rhs.value[1];
-      result.value[2] = value[2] + rhs.value[2];
-
-      return result;
+      return TVector3D<T>(value[0] + rhs.value[0], value[1] + rhs.value[1], value[2] + rhs.value[2]);
     }
 
     /// @brief Subtracts two vectors
     /// @param[in] rhs: The vector to subtract from *this.
     /// @returns The result of the subtraction.
+    /// @version 2026-10-19/GGB - Made constexpr noexcept.
     /// @version 2012-12-27/GGB - Function created.
 
-    inline TVector3D<T> operator -(TVector3D<T> const &rhs) const
+    constexpr TVector3D<T> operator -(TVector3D<T> const &rhs) const noexcept
+    {
+      return TVector3D<T>(value[0] - rhs.value[0], value[1] - rhs.value[1], value[2] - rhs.value[2]);
+    }
+
+    /// @brief Unary negation operator.
+    /// @returns The negative of the vector. (-x, -y, -z)
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
+
+    constexpr TVector3D<T> operator -() const noexcept
+    {
+      return TVector3D<T>(-value[0], -value[1], -value[2]);
+    }
+
+    /// @brief Adds a vector to this vector.
+    /// @param[in] rhs: The vector to add.
+    /// @returns *this
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
+
+    constexpr TVector3D &operator +=(TVector3D<T> const &rhs) noexcept
     {
-      TVector3D<T> result;
+      value[0] += rhs.value[0];
+      value[1] += rhs.value[1];
+      value[2] += rhs.value[2];
 
-      result.value[0] = value[0] - rhs.value[0];
-      result.value[1] = value[1] - rhs.value[1];
-      result.value[2] = value[2] - rhs.value[2];
+      return *this;
+    }
 
-      return result;
+    /// @brief Subtracts a vector from this vector.
+    /// @param[in] rhs: The vector to subtract.
+    /// @returns *this
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
+
+    constexpr TVector3D &operator -=(TVector3D<T> const &rhs) noexcept
+    {
+      value[0] -= rhs.value[0];
+      value[1] -= rhs.value[1];
+      value[2] -= rhs.value[2];
+
+      return *this;
     }
 
     /// @brief Multiply the point (vector) by a constant value.
     /// @param[in] mult: Value to multiply.
     /// @returns The vector multiplied by the constant value.
+    /// @version 2026-10-19/GGB - Made constexpr noexcept.
     /// @version 2012-12-27/GGB - Function created.
 
     template<typename U>
-    inline TVector3D &operator *= (U mult)
+    constexpr TVector3D &operator *= (U mult) noexcept
     {
       value[0] *= mult;
       value[1] *= mult;
@@ -113,60 +153,89 @@ namespace MCL
       return *this;
     }
 
+    /// @brief Multiply the vector by a constant value.
+    /// @param[in] mult: Value to multiply.
+    /// @returns The scaled vector.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
+
+    constexpr TVector3D<T> operator *(T mult) const noexcept
+    {
+      return TVector3D<T>(value[0] * mult, value[1] * mult, value[2] * mult);
+    }
+
     /// @brief Less than equal to operator
     //
+    // 2026-10-19/GGB - Made constexpr noexcept.
     // 2013-01-10/GGB - Function created.
 
-    inline bool operator <= (TVector3D<T> const &rhs) const
+    constexpr bool operator <= (TVector3D<T> const &rhs) const noexcept
     {
-      return (square(value[0]) + square(value[1]) + square(value[2])) < (square(rhs.value[0]) + square(rhs.value[1]) + square(rhs.value[2]));
+      return (pow2(value[0]) + pow2(value[1]) + pow2(value[2])) < (pow2(rhs.value[0]) + pow2(rhs.value[1]) + pow2(rhs.value[2]));
     }
 
+    /// @brief Returns the vector coordinate at the relevant position. The index is not checked, use at() for a checked
+    ///        access.
+    /// @param[in] index: The index to get the value of [0; 2]
+    /// @returns Reference to the vector position.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Removed the range check. (Moved to at())
+    /// @version 2012-12-28/GGB - Function created.
+
+    constexpr T &operator[](int index) noexcept { return value[index]; }
+
+    /// @brief Returns the vector coordinate at the relevant position. The index is not checked, use at() for a checked
+    ///        access.
+    /// @param[in] index: The index to get the value of [0; 2]
+    /// @returns Reference to the value at position.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Removed the range check. (Moved to at())
+    /// @version 2013-01-13/GGB - Function created.
+
+    constexpr T const &operator[](int index) const noexcept { return value[index]; }
+
     /// @brief Returns the vector coordinate at the relevant position.
     /// @param[in] index: The index to get the value of
     /// @returns Reference to the vector position.
     /// @throws std::out_of_range
-    /// @version 2012-12-28/GGB - Function created.
+    /// @version 2026-10-19/GGB - Function created.
 
-    inline T &operator[](int index)
+    constexpr T &at(int index)
     {
       if ( (index < 0) || (index > 2) )
       {
         throw std::out_of_range("Index out of Range. [0; 2]");
-      }
-      else
-      {
-        return value[index];
       };
+
+      return value[index];
     }
 
     /// @brief Returns the vector coordinate at the relevant position.
     /// @param[in] index: The index to get the value of
     /// @returns Reference to the value at position.
     /// @throws std::out_of_range
-    /// @version 2013-01-13/GGB - Function created.
+    /// @version 2026-10-19/GGB - Function created.
 
-    inline T const &operator[](int index) const
+    constexpr T const &at(int index) const
     {
       if ( (index < 0) || (index > 2) )
       {
         throw std::out_of_range("Index out of Range. [0; 2]");
-      }
-      else
-      {
-        return value[index];
       };
+
+      return value[index];
     }
 
     /// @brief Returns the dot product of two 3D vectors.
     /// @param[in] rhs: The vector to dot with this.
     /// @returns The dot product of the two vectors.
+    /// @version 2026-10-19/GGB - Made constexpr noexcept.
     /// @version 2012-12-27/GGB - Function created.
 
     template<typename U>
-    inline FP_t dot(TVector3D<U> const &rhs) const
+    constexpr FP_t dot(TVector3D<U> const &rhs) const noexcept
     {
-      return (value[0] * rhs.value[0] + value[1] * rhs.value[1] + value[2] * rhs.value[2]);
+      return (value[0] * rhs.x() + value[1] * rhs.y() + value[2] * rhs.z());
     }
 
     /// @brief Determines the normal (unit vector) of the vector.
@@ -175,33 +244,25 @@ namespace MCL
     /// @throws None.
     /// @version 2012-12-28/GGB - Function created.
 
-    inline TVector3D normalise() const
+    TVector3D normalise() const noexcept
     {
-      TVector3D<T> result;
-
       FP_t invlen = 1.0 / std::sqrt(MCL::pow2(value[0]) + MCL::pow2(value[1]) + MCL::pow2(value[2]) );
-      result.value[0] = value[0] * invlen;
-      result.value[1] = value[1] * invlen;
-      result.value[2] = value[2] * invlen;
 
-      return result;
+      return TVector3D<T>(value[0] * invlen, value[1] * invlen, value[2] * invlen);
     }
 
     /// @brief Returns the cross product of two 3D vectors.
     /// @param[in] rhs: The vector to cross product with this vector.
     /// @returns The cross product of the vectors.
     /// @throws None.
+    /// @version 2026-10-19/GGB - Corrected the x component. (value[2] * rhs.value[1])
     /// @version 2012-12-27/GGB - Function created.
 
-    inline TVector3D<T> cross(TVector3D<T> rhs) const noexcept
+    constexpr TVector3D<T> cross(TVector3D<T> rhs) const noexcept
     {
-      TVector3D<T> result;
-
-      result.value[0] = value[1] * rhs.value[2] - value[2] - rhs.value[1];
-      result.value[1] = value[2] * rhs.value[0] - value[0] * rhs.value[2];
-      result.value[2] = value[0] * rhs.value[1] - value[1] * rhs.value[0];
-
-      return result;
+      return TVector3D<T>(value[1] * rhs.value[2] - value[2] * rhs.value[1],
+                          value[2] * rhs.value[0] - value[0] * rhs.value[2],
+                          value[0] * rhs.value[1] - value[1] * rhs.value[0]);
     }
 
     /// @brief Returns the length of a vector.
@@ -211,45 +272,64 @@ namespace MCL
 
     FP_t length() const noexcept
     {
-      return sqrt(pow2(value[0]) + pow2(value[1]) + pow2(value[2]) );
+      return std::sqrt(pow2(value[0]) + pow2(value[1]) + pow2(value[2]) );
     }
 
   };  // class TVector3
 
+  /// @brief Multiply a vector by a constant value.
+  /// @param[in] mult: Value to multiply.
+  /// @param[in] vector: The vector to scale.
+  /// @returns The scaled vector.
+  /// @throws None.
+  /// @version 2026-10-19/GGB - Function created.
+
+  template<typename T>
+  constexpr TVector3D<T> operator *(T mult, TVector3D<T> const &vector) noexcept
+  {
+    return vector * mult;
+  }
+
+  /// @brief Fused multiply-add. Calculates a + b * s in a single expression, without intermediate vectors.
+  /// @param[in] a: The vector to add to.
+  /// @param[in] b: The vector to scale.
+  /// @param[in] s: The scale factor.
+  /// @returns a + b * s
+  /// @throws None.
+  /// @version 2026-10-19/GGB - Function created.
+
+  template<typename T>
+  constexpr TVector3D<T> madd(TVector3D<T> const &a, TVector3D<T> const &b, T s) noexcept
+  {
+    return TVector3D<T>(a.x() + b.x() * s, a.y() + b.y() * s, a.z() + b.z() * s);
+  }
+
   /// @brief Function to determine the ceil() of a vector.
   /// @param[in] val - The vector to determine the ceiling of.
   /// @returns The vector ceiling.
   /// @throws None.
+  /// @version 2026-10-19/GGB - Call std::ceil. (The unqualified call found this function only.)
   /// @version 2013-01-13/GGB - Function created.
 
   template<typename U>
-  TVector3D<U> ceil(TVector3D<U> const &val)
+  TVector3D<U> ceil(TVector3D<U> const &val) noexcept
   {
-    MCL::TVector3D<U> returnValue;
-
-    returnValue.x() = ceil(val.x());
-    returnValue.y() = ceil(val.y());
-    returnValue.z() = ceil(val.z());
-
-    return returnValue;
+    return TVector3D<U>(std::ceil(val.x()), std::ceil(val.y()), std::ceil(val.z()));
   }
 
   /// Function to determine the floor of a vector.
   //
+  // 2026-10-19/GGB - Call std::floor.
   // 2013-01-13/GGB - Function created.
 
   template<typename U>
-  TVector3D<U> floor(TVector3D<U> const &val)
+  TVector3D<U> floor(TVector3D<U> const &val) noexcept
   {
-    MCL::TVector3D<U> returnValue;
-
-    returnValue.x() = floor(val.x());
-    returnValue.y() = floor(val.y());
-    returnValue.z() = floor(val.z());
-
-    return returnValue;
+    return TVector3D<U>(std::floor(val.x()), std::floor(val.y()), std::floor(val.z()));
   }
 
+  static_assert(std::is_trivially_copyable_v<TVector3D<FP_t>>);
+
 }  // namespace MCL
 
 #endif // MCL_TVECTOR3D_HPP
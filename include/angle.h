@@ -30,7 +30,8 @@
 //
 // CLASS HIERARCHY:     CAngle
 //
-// HISTORY:             2020-03-21 GGB - Added negation operator for CAngle
+// HISTORY:             2026-10-19 GGB - A2SD() implemented.
+//                      2020-03-21 GGB - Added negation operator for CAngle
 //                      2015-09-27 GGB - File Created
 //
 //*********************************************************************************************************************************
@@ -93,7 +94,7 @@ namespace MCL
 
       // Stringification functions
 
-    virtual std::string A2SD() const {return std::string(); }
+    virtual std::string A2SD() const;
     virtual std::string A2SHMS() const;
     virtual std::string A2SDMS() const;
 
@@ -0,0 +1,105 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Maths Class Library
+// FILE:								angleArray
+// SUBSYSTEM:						Angle class
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman (GGB)
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+//
+// OVERVIEW:						An array of angles. The angles are stored contiguously as radians, without the per object overhead of
+//                      CAngle. The conversion, normalisation and trigonometric functions operate on the whole array and are
+//                      multi-threaded for large arrays.
+//
+// CLASSES INCLUDED:		angleArray_t
+//
+// CLASS HIERARCHY:     angleArray_t
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_ANGLEARRAY_H
+#define MCL_ANGLEARRAY_H
+
+  // Standard C++ libraries
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+  // MCL Library
+
+#include "angle.h"
+#include "config.h"
+#include "constants.h"
+
+namespace MCL
+{
+  class angleArray_t
+  {
+  private:
+    std::vector<FP_t> angles_;      ///< Angles. Always stored as radians.
+
+  protected:
+  public:
+    angleArray_t() = default;
+    explicit angleArray_t(std::size_t, FP_t = 0);
+    angleArray_t(std::span<FP_t const>, EAngleFormat = AF_RADIANS);
+    explicit angleArray_t(std::span<CAngle const>);
+
+    std::size_t size() const noexcept { return angles_.size(); }
+    bool empty() const noexcept { return angles_.empty(); }
+    void resize(std::size_t newSize) { angles_.resize(newSize); }
+    void reserve(std::size_t capacity) { angles_.reserve(capacity); }
+    void clear() noexcept { angles_.clear(); }
+
+    void push_back(CAngle const &angle) { angles_.push_back(angle.radians()); }
+    CAngle at(std::size_t index) const { return CAngle(angles_.at(index)); }
+
+    FP_t &operator[](std::size_t index) noexcept { return angles_[index]; }
+    FP_t operator[](std::size_t index) const noexcept { return angles_[index]; }
+
+      // Conversion functions
+
+    std::span<FP_t> radians() noexcept { return angles_; }
+    std::span<FP_t const> radians() const noexcept { return angles_; }
+
+    void assign(std::span<FP_t const>, EAngleFormat = AF_RADIANS);
+    void convert(std::span<FP_t>, EAngleFormat) const;
+    void degrees(std::span<FP_t> dest) const { convert(dest, AF_Dd); }
+    void hours(std::span<FP_t>) const;
+
+      // Normalisation functions
+
+    void moduloN(FP_t = PI_2);
+    void moduloR(FP_t = PI);
+
+      // Trigonometric functions
+
+    void sin(std::span<FP_t>) const;
+    void cos(std::span<FP_t>) const;
+    void tan(std::span<FP_t>) const;
+    void sincos(std::span<FP_t>, std::span<FP_t>) const;
+  };
+
+}   // namespace MCL
+
+#endif // MCL_ANGLEARRAY_H
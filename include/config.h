@@ -49,12 +49,13 @@
   #undef MCL_CONTROL
 #endif  // EMBEDDED
 
+#include <atomic>
 #include <cstddef>
 
 namespace MCL
 {
 #ifndef MCL_NOMT
-  extern size_t maxThreads;
+  extern std::atomic<size_t> maxThreads;
 #endif // MCL_NOMT
 
 #ifdef MCL_FPT_SINGLE
@@ -28,8 +28,11 @@
 //
 // CLASSES INCLUDED:    CMCLError
 //                      CMCLCodeError
+//                      operation_cancelled
+//                      deadline_exceeded
 //
-// HISTORY:             2015-09-22 GGB - astroManager 2015.09 release
+// HISTORY:             2026-10-19 GGB - Added operation_cancelled and deadline_exceeded.
+//                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2013-09-30 GGB - astroManager 2013.09 release.
 //                      2013-03-22 GGB - astroManager 2013.03 release.
 //                      2013-01-20 GGB - astroManager 0000.00 release.
@@ -61,6 +64,30 @@ namespace MCL
     virtual ~divide_by_zero() = default;
   };
 
+  /// @brief Thrown by a cancellation point when a stop has been requested for the operation.
+
+  class operation_cancelled : public std::runtime_error
+  {
+  private:
+    operation_cancelled() = delete;
+  public:
+    operation_cancelled(std::string const &arg) : std::runtime_error(arg) {}
+    operation_cancelled(operation_cancelled const &) = default;
+    virtual ~operation_cancelled() = default;
+  };
+
+  /// @brief Thrown by a cancellation point when the time budget of the operation has been exceeded.
+
+  class deadline_exceeded : public operation_cancelled
+  {
+  private:
+    deadline_exceeded() = delete;
+  public:
+    deadline_exceeded(std::string const &arg) : operation_cancelled(arg) {}
+    deadline_exceeded(deadline_exceeded const &) = default;
+    virtual ~deadline_exceeded() = default;
+  };
+
 }	// namespace MCL
 
 #endif // MCL_MCLERROR_H
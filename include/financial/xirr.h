@@ -31,7 +31,8 @@
 // FUNCTIONS INCLUDED:  XIRR
 //
 //
-// HISTORY:             2023-07-18 GGB - File Created
+// HISTORY:             2026-10-19 GGB - Added the asynchronous overload.
+//                      2023-07-18 GGB - File Created
 //
 //*********************************************************************************************************************************
 
@@ -41,12 +42,16 @@
   // Standard C++ library
 
 #include <chrono>
+#include <future>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
   // MCL library
 
+#include "../utility/async.hpp"
+#include "../utility/workspace.hpp"
+
 namespace MCL
 {
 
@@ -54,7 +59,8 @@ namespace MCL
   using cashflow_t = std::pair<date_t, double>;
   using cashflowVector_t = std::vector<cashflow_t>;
 
-  double XIRR(cashflowVector_t const &, double = 0.00001);
+  double XIRR(cashflowVector_t const &, double = 0.00001, workspace_t & = workspace_t::local());
+  std::future<double> XIRR(asyncOptions_t const &, cashflowVector_t, double = 0.00001);
 }
 
 #endif // XIRR_H
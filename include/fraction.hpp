@@ -10,7 +10,7 @@
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
 //
-//                      Copyright 2020 Gavin Blakeman.
+//                      Copyright 2020, 2026 Gavin Blakeman.
 //                      This file is part of the Maths Class Library (MCL)
 //
 //                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
@@ -29,7 +29,8 @@
 // CLASSES INCLUDED:    None
 //
 //
-// HISTORY:             2020-04-24 GGB - File Created
+// HISTORY:             2026-10-19 GGB - constexpr fraction_t with cross reduction and 128 bit intermediates.
+//                      2020-04-24 GGB - File Created
 //
 //*********************************************************************************************************************************
 
@@ -40,6 +41,7 @@
 
 #include <cstdint>
 #include <exception>
+#include <limits>
 #include <stdexcept>
 
   // MCL library header files
@@ -49,116 +51,228 @@
 namespace MCL
 {
 
+  /// @brief  Fraction (rational number) with 64 bit numerator and denominator. The fraction is always stored normalised (lowest
+  ///         terms, positive denominator). The arithmetic operators cross-reduce before multiplying and form intermediate values
+  ///         in 128 bits, so they only fail if the normalised result itself does not fit in 64 bits. In that case
+  ///         std::overflow_error is thrown.
+
   class fraction_t
   {
   private:
+#if defined(__SIZEOF_INT128__)
+    using wide_t = __int128;
+#else
+    using wide_t = std::int64_t;                ///< No 128 bit type. Overflowing intermediates are reported instead.
+#endif
+    using uint_t = std::uint64_t;
+
     std::int64_t numerator_ = 0;
     std::int64_t denominator_ = 1;
 
-    void normalise()
+    /// @brief      Multiply two intermediate values.
+    /// @throws     std::overflow_error (only when no 128 bit type is available.)
+
+    static constexpr wide_t multiply(wide_t a, wide_t b)
     {
-      int sign = 1;
-      if (numerator_ < 0)
+#if !defined(__SIZEOF_INT128__)
+      if ( (a != 0) && (detail::uabs(b) > detail::uabs(std::numeric_limits<wide_t>::max()) / detail::uabs(a)) )
       {
-        sign *= -1;
-        numerator_ = -numerator_;
+        throw std::overflow_error("MCL::fraction_t - Intermediate value overflow.");
       };
-      if (denominator_ < 0)
+#endif
+      return a * b;
+    }
+
+    /// @brief      Add two intermediate values.
+    /// @throws     std::overflow_error (only when no 128 bit type is available.)
+
+    static constexpr wide_t add(wide_t a, wide_t b)
+    {
+#if !defined(__SIZEOF_INT128__)
+      if ( ((b > 0) && (a > std::numeric_limits<wide_t>::max() - b)) ||
+           ((b < 0) && (a < std::numeric_limits<wide_t>::min() - b)) )
+      {
+        throw std::overflow_error("MCL::fraction_t - Intermediate value overflow.");
+      };
+#endif
+      return a + b;
+    }
+
+    /// @brief      Stores an already reduced numerator/denominator pair.
+    /// @param[in]  n: The numerator. (Carries the sign)
+    /// @param[in]  d: The denominator. (Positive)
+    /// @throws     std::overflow_error if either value cannot be represented in 64 bits.
+
+    constexpr void assign(wide_t n, wide_t d)
+    {
+      if ( (n > std::numeric_limits<std::int64_t>::max()) || (n < std::numeric_limits<std::int64_t>::min()) ||
+           (d > std::numeric_limits<std::int64_t>::max()) )
       {
-        sign *= -1;
-        denominator_ = -denominator_;
+        throw std::overflow_error("MCL::fraction_t - Result not representable.");
       };
 
-      std::int64_t temp = gcd(numerator_, denominator_);
-      numerator_ /= temp * sign;
-      denominator_ /= temp;
+      numerator_ = static_cast<std::int64_t>(n);
+      denominator_ = static_cast<std::int64_t>(d);
+    }
+
+    /// @brief      Reduces the fraction to lowest terms with a positive denominator. A zero numerator gives 0/1.
+    /// @throws     std::overflow_error if the normalised denominator cannot be represented. (-2^63 denominator)
+
+    constexpr void normalise()
+    {
+      bool negative = (numerator_ < 0) != (denominator_ < 0);
+      uint_t n = detail::uabs(numerator_);
+      uint_t d = detail::uabs(denominator_);
+      uint_t g = detail::gcd_binary(n, d);
+
+      n /= g;
+      d /= g;
+
+      if ( (d > static_cast<uint_t>(std::numeric_limits<std::int64_t>::max())) ||
+           (n > static_cast<uint_t>(std::numeric_limits<std::int64_t>::max()) + (negative ? 1 : 0)) )
+      {
+        throw std::overflow_error("MCL::fraction_t - Result not representable.");
+      };
+
+      numerator_ = negative ? static_cast<std::int64_t>(uint_t{0} - n) : static_cast<std::int64_t>(n);
+      denominator_ = static_cast<std::int64_t>(d);
+    }
+
+    /// @brief      Adds (a/b) + (c/d) using Knuth's method. Only the gcd of the denominators is needed, and the result is
+    ///             already in lowest terms.
+    /// @param[in]  c: The numerator to add.
+    /// @param[in]  d: The denominator to add.
+
+    constexpr void addFraction(wide_t c, std::int64_t d)
+    {
+      uint_t g = detail::gcd_binary(static_cast<uint_t>(denominator_), static_cast<uint_t>(d));
+      wide_t t = add(multiply(numerator_, d / static_cast<std::int64_t>(g)),
+                     multiply(c, denominator_ / static_cast<std::int64_t>(g)));
+
+      wide_t tModG = t % static_cast<wide_t>(g);
+      uint_t g2 = detail::gcd_binary(static_cast<uint_t>(tModG < 0 ? -tModG : tModG), g);
+
+      assign(t / static_cast<wide_t>(g2),
+             multiply(denominator_ / static_cast<std::int64_t>(g), d / static_cast<std::int64_t>(g2)));
+    }
+
+    /// @brief      Multiplies by (c/d). Cross-reduces before multiplying so the result is already in lowest terms.
+    /// @param[in]  c: The numerator to multiply by.
+    /// @param[in]  d: The denominator to multiply by. (Positive, and coprime to c.)
+
+    constexpr void multiplyFraction(std::int64_t c, uint_t d)
+    {
+      uint_t g1 = detail::gcd_binary(detail::uabs(numerator_), d);
+      uint_t g2 = detail::gcd_binary(detail::uabs(c), static_cast<uint_t>(denominator_));
+
+      wide_t n = multiply(static_cast<wide_t>(numerator_) / static_cast<wide_t>(g1),
+                          static_cast<wide_t>(c) / static_cast<wide_t>(g2));
+
+      assign(n, multiply(static_cast<wide_t>(static_cast<uint_t>(denominator_) / g2), static_cast<wide_t>(d / g1)));
     }
 
   protected:
   public:
-    fraction_t() {}
-    fraction_t(std::int64_t n, std::int64_t d) : numerator_(n), denominator_(d)
+    constexpr fraction_t() noexcept {}
+    constexpr fraction_t(std::int64_t n, std::int64_t d) : numerator_(n), denominator_(d)
     {
       if (d == 0)
       {
         throw std::invalid_argument("CFraction::CFraction denominator cannot be zero.");
-      }
-      else if (n == 0)
-      {
-        numerator_ = 0;
-        denominator_ = 1;
       };
       normalise();
     }
-    fraction_t(fraction_t const &other) : numerator_(other.numerator_), denominator_(other.denominator_) {}
+    constexpr fraction_t(fraction_t const &) noexcept = default;
+    constexpr fraction_t &operator=(fraction_t const &) noexcept = default;
 
-    std::int64_t &numerator() { return numerator_; }
-    std::int64_t &denominator() { return denominator_; }
+    constexpr std::int64_t &numerator() noexcept { return numerator_; }
+    constexpr std::int64_t &denominator() noexcept { return denominator_; }
+    constexpr std::int64_t numerator() const noexcept { return numerator_; }
+    constexpr std::int64_t denominator() const noexcept { return denominator_; }
 
-    operator std::int64_t() { return static_cast<std::int64_t>(numerator_) / static_cast<std::int64_t>(denominator_); }
-    operator float() { return static_cast<float>(numerator_) / static_cast<float>(denominator_); }
-    operator double() { return static_cast<double>(numerator_) / static_cast<double>(denominator_); }
+    constexpr operator std::int64_t() const noexcept { return numerator_ / denominator_; }
+    constexpr operator float() const noexcept { return static_cast<float>(numerator_) / static_cast<float>(denominator_); }
+    constexpr operator double() const noexcept { return static_cast<double>(numerator_) / static_cast<double>(denominator_); }
 
-    fraction_t &operator+=(fraction_t const &rhs)
-    {
-       std::int64_t temp = denominator_ * rhs.denominator_;
-       numerator_ = numerator_ * rhs.denominator_ + rhs.numerator_ * denominator_;
-       denominator_ = temp;
+    constexpr bool operator==(fraction_t const &) const noexcept = default;
+
+    /// @brief      Addition assignment.
+    /// @param[in]  rhs: The value to add.
+    /// @returns    *this
+    /// @throws     std::overflow_error
+    /// @version    2026-10-19/GGB - Use gcd of denominators and 128 bit intermediates.
 
-       normalise();
-       return *this;
+    constexpr fraction_t &operator+=(fraction_t const &rhs)
+    {
+      addFraction(rhs.numerator_, rhs.denominator_);
+      return *this;
     }
 
-    fraction_t operator+(fraction_t const &rhs)
+    constexpr fraction_t operator+(fraction_t const &rhs) const
     {
       fraction_t temp(*this);
       temp += rhs;
       return temp;
     }
 
-    fraction_t &operator -=(fraction_t const &rhs)
-    {
-      std::int64_t temp = denominator_ * rhs.denominator_;
-      numerator_ = numerator_ * rhs.denominator_ - rhs.numerator_ * denominator_;
-      denominator_ = temp;
+    /// @brief      Subtraction assignment.
+    /// @param[in]  rhs: The value to subtract.
+    /// @returns    *this
+    /// @throws     std::overflow_error
+    /// @version    2026-10-19/GGB - Use gcd of denominators and 128 bit intermediates.
 
-      normalise();
+    constexpr fraction_t &operator -=(fraction_t const &rhs)
+    {
+      addFraction(-static_cast<wide_t>(rhs.numerator_), rhs.denominator_);
       return *this;
     }
 
-    fraction_t operator-(fraction_t const &rhs)
+    constexpr fraction_t operator-(fraction_t const &rhs) const
     {
       fraction_t temp(*this);
       temp -= rhs;
       return temp;
     }
 
-    fraction_t &operator*=(fraction_t const &rhs)
-    {
-      numerator_ *= rhs.numerator_;
-      denominator_ *= rhs.denominator_;
+    /// @brief      Multiplication assignment.
+    /// @param[in]  rhs: The value to multiply by.
+    /// @returns    *this
+    /// @throws     std::overflow_error
+    /// @version    2026-10-19/GGB - Cross-reduce before multiplying.
 
-      normalise();
+    constexpr fraction_t &operator*=(fraction_t const &rhs)
+    {
+      multiplyFraction(rhs.numerator_, static_cast<uint_t>(rhs.denominator_));
       return *this;
     }
 
-    fraction_t operator*(fraction_t const &rhs)
+    constexpr fraction_t operator*(fraction_t const &rhs) const
     {
       fraction_t temp(*this);
       temp *= rhs;
       return temp;
     }
 
-    fraction_t &operator/=(fraction_t const rhs)
+    /// @brief      Division assignment.
+    /// @param[in]  rhs: The divisor.
+    /// @returns    *this
+    /// @throws     std::invalid_argument if rhs is zero.
+    /// @throws     std::overflow_error
+    /// @version    2026-10-19/GGB - Cross-reduce before multiplying.
+
+    constexpr fraction_t &operator/=(fraction_t const rhs)
     {
-      numerator_ *= rhs.denominator_;
-      denominator_ *= rhs.numerator_;
+      if (rhs.numerator_ == 0)
+      {
+        throw std::invalid_argument("MCL::fraction_t - Division by zero.");
+      };
 
-      normalise();
+      std::int64_t c = (rhs.numerator_ < 0) ? -rhs.denominator_ : rhs.denominator_;
+      multiplyFraction(c, detail::uabs(rhs.numerator_));
       return *this;
     }
 
-    fraction_t operator/(fraction_t const &rhs)
+    constexpr fraction_t operator/(fraction_t const &rhs) const
     {
       fraction_t temp(*this);
       temp /= rhs;
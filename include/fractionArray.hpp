@@ -0,0 +1,323 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								fractionArray.hpp
+// SUBSYSTEM:						Fractional class
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Operations on arrays of fractions held as separate numerator and denominator arrays. The results are
+//                      identical to the fraction_t operators, but the GCDs of a block of fractions are determined together
+//                      with the lane GCD.
+//
+// CLASSES INCLUDED:    None
+//
+// FUNCTIONS INCLUDED:  fractionReduce(...)
+//                      fractionAdd(...)
+//                      fractionMultiply(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef FRACTIONARRAY_HPP
+#define FRACTIONARRAY_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+  // MCL library header files
+
+#include "fraction.hpp"
+#include "functions/gcdArray.hpp"
+#include "utility/parallel.hpp"
+
+namespace MCL
+{
+  namespace detail
+  {
+    using fractionIndex_t = std::span<std::int64_t>::size_type;
+
+    /// @brief      Checks that the numerator and denominator arrays all have the same size.
+    /// @throws     std::invalid_argument
+
+    inline void fractionCheckSize(std::size_t s1, std::size_t s2, std::size_t s3, char const *function)
+    {
+      if ( (s1 != s2) || (s1 != s3) )
+      {
+        throw std::invalid_argument(std::string("MCL::") + function + " - Arrays must be the same size.");
+      };
+    }
+
+    /// @brief      Stores a reduced result, flagging results that do not fit in 64 bits.
+    /// @param[in]  negative: true if the fraction is negative.
+    /// @param[in]  n: The magnitude of the numerator.
+    /// @param[in]  d: The denominator.
+    /// @param[out] numerator: The numerator to store.
+    /// @param[out] denominator: The denominator to store.
+    /// @returns    true if the values overflowed.
+
+    template<typename W>
+    inline bool fractionStore(bool negative, W n, W d, std::int64_t &numerator, std::int64_t &denominator) noexcept
+    {
+      W constexpr maxValue = static_cast<W>(std::numeric_limits<std::int64_t>::max());
+      bool overflow = (d > maxValue) || (n > maxValue + (negative ? 1 : 0));
+
+      numerator = negative ? static_cast<std::int64_t>(std::uint64_t{0} - static_cast<std::uint64_t>(n))
+                           : static_cast<std::int64_t>(n);
+      denominator = static_cast<std::int64_t>(d);
+
+      return overflow;
+    }
+  }
+
+  /// @brief      Reduces an array of fractions to lowest terms with positive denominators. Zero numerators give 0/1.
+  /// @param[in,out] numerators: The numerators.
+  /// @param[in,out] denominators: The denominators.
+  /// @throws     std::invalid_argument if the arrays differ in size, or any denominator is zero. (Nothing is modified.)
+  /// @throws     std::overflow_error if a reduced value is not representable. (Only n/-2^63 with n odd.)
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline void fractionReduce(std::span<std::int64_t> numerators, std::span<std::int64_t> denominators)
+  {
+    std::atomic<bool> overflow = false;
+
+    detail::fractionCheckSize(numerators.size(), denominators.size(), denominators.size(), "fractionReduce");
+
+    if (std::find(denominators.begin(), denominators.end(), 0) != denominators.end())
+    {
+      throw std::invalid_argument("MCL::fractionReduce - Denominator cannot be zero.");
+    };
+
+    parallelFor(numerators.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      std::uint64_t g[detail::GCD_LANES];
+      std::uint64_t v[detail::GCD_LANES];
+      bool threadOverflow = false;
+
+      for (std::size_t index = indexBegin; index < indexEnd; index += detail::GCD_LANES)
+      {
+        std::size_t n = std::min(detail::GCD_LANES, indexEnd - index);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          g[l] = detail::uabs(numerators[index + l]);
+          v[l] = detail::uabs(denominators[index + l]);
+        };
+
+        detail::gcdLanes(g, v, n);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          std::int64_t &num = numerators[index + l];
+          std::int64_t &den = denominators[index + l];
+          bool negative = (num < 0) != (den < 0);
+
+          threadOverflow |= detail::fractionStore(negative, detail::uabs(num) / g[l], detail::uabs(den) / g[l], num, den);
+        };
+      };
+
+      if (threadOverflow)
+      {
+        overflow = true;
+      };
+    });
+
+    if (overflow)
+    {
+      throw std::overflow_error("MCL::fractionReduce - Result not representable.");
+    };
+  }
+
+#if defined(__SIZEOF_INT128__)
+
+  /// @brief      Adds two arrays of normalised fractions. (a/b + c/d) The result is normalised.
+  /// @param[in]  numA: Numerators of the first fractions.
+  /// @param[in]  denA: Denominators of the first fractions. (Positive)
+  /// @param[in]  numB: Numerators of the second fractions.
+  /// @param[in]  denB: Denominators of the second fractions. (Positive)
+  /// @param[out] numR: Numerators of the results. (May alias an input.)
+  /// @param[out] denR: Denominators of the results. (May alias an input.)
+  /// @throws     std::invalid_argument if the arrays differ in size.
+  /// @throws     std::overflow_error if a result is not representable. (The result arrays are then incomplete.)
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline void fractionAdd(std::span<std::int64_t const> numA, std::span<std::int64_t const> denA,
+                          std::span<std::int64_t const> numB, std::span<std::int64_t const> denB,
+                          std::span<std::int64_t> numR, std::span<std::int64_t> denR)
+  {
+    using wide_t = __int128;
+    using uwide_t = unsigned __int128;
+
+    std::atomic<bool> overflow = false;
+
+    detail::fractionCheckSize(numA.size(), denA.size(), numB.size(), "fractionAdd");
+    detail::fractionCheckSize(numA.size(), denB.size(), numR.size(), "fractionAdd");
+    detail::fractionCheckSize(numA.size(), denR.size(), denR.size(), "fractionAdd");
+
+    parallelFor(numA.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      std::uint64_t g[detail::GCD_LANES];
+      std::uint64_t g2[detail::GCD_LANES];
+      std::uint64_t v[detail::GCD_LANES];
+      wide_t t[detail::GCD_LANES];
+      bool threadOverflow = false;
+
+      for (std::size_t index = indexBegin; index < indexEnd; index += detail::GCD_LANES)
+      {
+        std::size_t n = std::min(detail::GCD_LANES, indexEnd - index);
+
+          // g = gcd(b, d)
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          g[l] = static_cast<std::uint64_t>(denA[index + l]);
+          v[l] = static_cast<std::uint64_t>(denB[index + l]);
+        };
+        detail::gcdLanes(g, v, n);
+
+          // t = a * (d/g) + c * (b/g);  g2 = gcd(t mod g, g)
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          std::int64_t gs = static_cast<std::int64_t>(g[l]);
+
+          t[l] = static_cast<wide_t>(numA[index + l]) * (denB[index + l] / gs) +
+                 static_cast<wide_t>(numB[index + l]) * (denA[index + l] / gs);
+
+          wide_t tModG = t[l] % gs;
+          g2[l] = static_cast<std::uint64_t>(tModG < 0 ? -tModG : tModG);
+          v[l] = g[l];
+        };
+        detail::gcdLanes(g2, v, n);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          uwide_t num = static_cast<uwide_t>(t[l] < 0 ? -t[l] : t[l]) / g2[l];
+          uwide_t den = static_cast<uwide_t>(static_cast<std::uint64_t>(denA[index + l]) / g[l]) *
+                        (static_cast<std::uint64_t>(denB[index + l]) / g2[l]);
+
+          threadOverflow |= detail::fractionStore(t[l] < 0, num, den, numR[index + l], denR[index + l]);
+        };
+      };
+
+      if (threadOverflow)
+      {
+        overflow = true;
+      };
+    });
+
+    if (overflow)
+    {
+      throw std::overflow_error("MCL::fractionAdd - Result not representable.");
+    };
+  }
+
+  /// @brief      Multiplies two arrays of normalised fractions. (a/b * c/d) The values are cross-reduced before multiplying
+  ///             and the result is normalised.
+  /// @param[in]  numA: Numerators of the first fractions.
+  /// @param[in]  denA: Denominators of the first fractions. (Positive)
+  /// @param[in]  numB: Numerators of the second fractions.
+  /// @param[in]  denB: Denominators of the second fractions. (Positive)
+  /// @param[out] numR: Numerators of the results. (May alias an input.)
+  /// @param[out] denR: Denominators of the results. (May alias an input.)
+  /// @throws     std::invalid_argument if the arrays differ in size.
+  /// @throws     std::overflow_error if a result is not representable. (The result arrays are then incomplete.)
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline void fractionMultiply(std::span<std::int64_t const> numA, std::span<std::int64_t const> denA,
+                               std::span<std::int64_t const> numB, std::span<std::int64_t const> denB,
+                               std::span<std::int64_t> numR, std::span<std::int64_t> denR)
+  {
+    using uwide_t = unsigned __int128;
+
+    std::atomic<bool> overflow = false;
+
+    detail::fractionCheckSize(numA.size(), denA.size(), numB.size(), "fractionMultiply");
+    detail::fractionCheckSize(numA.size(), denB.size(), numR.size(), "fractionMultiply");
+    detail::fractionCheckSize(numA.size(), denR.size(), denR.size(), "fractionMultiply");
+
+    parallelFor(numA.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      std::uint64_t g1[detail::GCD_LANES];
+      std::uint64_t g2[detail::GCD_LANES];
+      std::uint64_t v[detail::GCD_LANES];
+      bool threadOverflow = false;
+
+      for (std::size_t index = indexBegin; index < indexEnd; index += detail::GCD_LANES)
+      {
+        std::size_t n = std::min(detail::GCD_LANES, indexEnd - index);
+
+          // g1 = gcd(a, d); g2 = gcd(c, b)
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          g1[l] = detail::uabs(numA[index + l]);
+          v[l] = static_cast<std::uint64_t>(denB[index + l]);
+        };
+        detail::gcdLanes(g1, v, n);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          g2[l] = detail::uabs(numB[index + l]);
+          v[l] = static_cast<std::uint64_t>(denA[index + l]);
+        };
+        detail::gcdLanes(g2, v, n);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          bool negative = (numA[index + l] < 0) != (numB[index + l] < 0);
+          uwide_t num = static_cast<uwide_t>(detail::uabs(numA[index + l]) / g1[l]) *
+                        (detail::uabs(numB[index + l]) / g2[l]);
+          uwide_t den = static_cast<uwide_t>(static_cast<std::uint64_t>(denA[index + l]) / g2[l]) *
+                        (static_cast<std::uint64_t>(denB[index + l]) / g1[l]);
+
+          threadOverflow |= detail::fractionStore(negative && (num != 0), num, den, numR[index + l], denR[index + l]);
+        };
+      };
+
+      if (threadOverflow)
+      {
+        overflow = true;
+      };
+    });
+
+    if (overflow)
+    {
+      throw std::overflow_error("MCL::fractionMultiply - Result not representable.");
+    };
+  }
+
+#endif // __SIZEOF_INT128__
+
+} // namespace MCL
+
+#endif // FRACTIONARRAY_HPP
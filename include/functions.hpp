@@ -73,10 +73,11 @@ namespace MCL
   /// @param[in] x: Value to square.
   /// @returns The value x^2.
   /// @throws None.
+  /// @version 2026-10-19/GGB - Made constexpr.
   /// @version 2014-12-31/GGB - Function created.
 
   template<typename T>
-  inline T pow2(T x)
+  constexpr T pow2(T x) noexcept
   {
     return x * x;
   }
@@ -84,10 +85,11 @@ namespace MCL
   /// @brief Calculates x^3 (cube)
   /// @param[in] x: The value to cube.
   /// @throws None.
+  /// @version 2026-10-19/GGB - Made constexpr.
   /// @version 2014-01-26/GGB - Function created.
 
   template<typename T>
-  inline T pow3(T x)
+  constexpr T pow3(T x) noexcept
   {
     return x * x * x;
   }
@@ -10,7 +10,7 @@
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
 //
-//                      Copyright 2020 Gavin Blakeman.
+//                      Copyright 2020, 2026 Gavin Blakeman.
 //                      This file is part of the Maths Class Library (MCL)
 //
 //                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
@@ -29,7 +29,8 @@
 // CLASSES INCLUDED:    None
 //
 //
-// HISTORY:             2020-04-24 GGB - File Created
+// HISTORY:             2026-10-19 GGB - Binary GCD replaces subtraction-only Euclid.
+//                      2020-04-24 GGB - File Created
 //
 //*********************************************************************************************************************************
 
@@ -38,18 +39,84 @@
 
   // Standard C++ library header files.
 
+#include <bit>
+#include <limits>
 #include <stdexcept>
 #include <type_traits>
 
 namespace MCL
 {
-  /// @brief Calculate the GCD using Euclid's algorithm.
-  /// @param[in] a: The first value
-  /// @param[in] b: Second value
+  namespace detail
+  {
+    /// @brief      Binary (Stein's) GCD on unsigned values. Powers of two are removed with std::countr_zero, so the loop
+    ///             executes at most log2(max(a, b)) times. gcd(0, b) = b and gcd(0, 0) = 0.
+    /// @param[in]  a: The first value
+    /// @param[in]  b: The second value
+    /// @returns    The greatest common divisor of a and b.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename U>
+    constexpr U gcd_binary(U a, U b) noexcept
+    {
+      static_assert(std::is_unsigned<U>::value, "Unsigned integer type required.");
+
+      if (a == 0)
+      {
+        return b;
+      }
+      else if (b == 0)
+      {
+        return a;
+      };
+
+      int shift = std::countr_zero(static_cast<U>(a | b));
+      a >>= std::countr_zero(a);
+
+      do
+      {
+        b >>= std::countr_zero(b);
+        if (a > b)
+        {
+          U temp = a;
+          a = b;
+          b = temp;
+        };
+        b -= a;
+      }
+      while (b != 0);
+
+      return a << shift;
+    }
 
+    /// @brief      Returns the magnitude of a signed value as the corresponding unsigned type. Safe for the most negative
+    ///             value of the type.
+    /// @param[in]  a: The value.
+    /// @returns    |a|
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    constexpr std::make_unsigned_t<T> uabs(T a) noexcept
+    {
+      using U = std::make_unsigned_t<T>;
+
+      return (a < 0) ? static_cast<U>(U{0} - static_cast<U>(a)) : static_cast<U>(a);
+    }
+
+  } // namespace detail
+
+  /// @brief      Calculate the GCD using the binary GCD (Stein's) algorithm.
+  /// @param[in]  a: The first value
+  /// @param[in]  b: Second value
+  /// @returns    The (positive) greatest common divisor of a and b.
+  /// @throws     std::runtime_error if either parameter is zero.
+  /// @throws     std::overflow_error if the result is not representable in T. (Only gcd(MIN, MIN).)
+  /// @version    2026-10-19/GGB - Replaced the subtraction-only Euclid with the binary GCD. The function is now constexpr.
+  /// @version    2020-04-24/GGB - Function created.
 
   template<typename T>
-  T gcd(T a, T b)
+  constexpr T gcd(T a, T b)
   {
     static_assert(std::is_integral<T>::value, "Signed Integer type required.");
     static_assert(std::is_signed<T>::value, "Signed integer type required.");
@@ -60,28 +127,14 @@ namespace MCL
     }
     else
     {
-      if (a < 0)
-      {
-        a = -a;
-      };
-      if (b < 0)
-      {
-        b = -b;
-      };
+      auto returnValue = detail::gcd_binary(detail::uabs(a), detail::uabs(b));
 
-      while (a != b)
+      if (returnValue > static_cast<std::make_unsigned_t<T>>(std::numeric_limits<T>::max()))
       {
-        if (a > b)
-        {
-          a -= b;
-        }
-        else
-        {
-          b -= a;
-        }
+        throw std::overflow_error("MCL::gcd - Result not representable.");
       };
 
-      return a;
+      return static_cast<T>(returnValue);
     };
   }
 
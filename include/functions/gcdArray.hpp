@@ -0,0 +1,403 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								gcdArray.hpp
+// SUBSYSTEM:						Maths Functions
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Array (batched) greatest common divisor and lowest common multiple functions.
+//                      The element-wise functions run the binary GCD in lanes of GCD_LANES values. Each lane steps with
+//                      selects rather than branches, so the inner loop can be vectorised by the compiler. A block finishes
+//                      when all its lanes have finished.
+//
+// CLASSES INCLUDED:    None
+//
+// FUNCTIONS INCLUDED:  gcd(span, span, span)
+//                      lcm(span, span, span)
+//                      gcd(span)
+//                      lcm(span)
+//                      commonDenominator(span)
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef GCDARRAY_HPP
+#define GCDARRAY_HPP
+
+  // Standard C++ library header files.
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+  // MCL library header files
+
+#include "gcd.hpp"
+#include "../utility/parallel.hpp"
+
+namespace MCL
+{
+  namespace detail
+  {
+    std::size_t constexpr GCD_LANES = 8;     ///< Number of values processed together by the lane GCD.
+
+    /// @brief      Binary GCD of n <= GCD_LANES pairs of values, without branches in the lane loops.
+    /// @param[in,out] u: The first values. Returns gcd(u[i], v[i]).
+    /// @param[in]  v: The second values. (Destroyed)
+    /// @param[in]  n: The number of lanes in use.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename U>
+    inline void gcdLanes(U *u, U *v, std::size_t n) noexcept
+    {
+      static_assert(std::is_unsigned<U>::value, "Unsigned integer type required.");
+
+      int constexpr mask = std::numeric_limits<U>::digits - 1;     // countr_zero(0) == digits, which masks to 0.
+      int shift[GCD_LANES];
+      U active;
+
+      for (std::size_t l = 0; l < n; l++)
+      {
+        U uZero = (u[l] == 0);
+
+        shift[l] = std::countr_zero(static_cast<U>(u[l] | v[l])) & mask;
+        u[l] = uZero ? v[l] : u[l];                           // gcd(0, v) = v
+        v[l] = uZero ? U{0} : v[l];
+        u[l] >>= (std::countr_zero(u[l]) & mask);
+      };
+
+      do
+      {
+        active = 0;
+        for (std::size_t l = 0; l < n; l++)
+        {
+          U vs = v[l] >> (std::countr_zero(v[l]) & mask);
+          U lo = std::min(u[l], vs);
+          U hi = std::max(u[l], vs);
+          bool running = (v[l] != 0);
+
+          u[l] = running ? lo : u[l];
+          v[l] = running ? static_cast<U>(hi - lo) : U{0};
+          active |= v[l];
+        };
+      }
+      while (active != 0);
+
+      for (std::size_t l = 0; l < n; l++)
+      {
+        u[l] <<= shift[l];
+      };
+    }
+
+    /// @brief      Lowest common multiple of two magnitudes.
+    /// @param[in]  a: First value.
+    /// @param[in]  b: Second value.
+    /// @param[out] overflow: Set to true if the result overflowed.
+    /// @returns    lcm(a, b). lcm(0, b) = 0
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename U>
+    inline U lcmChecked(U a, U b, bool &overflow) noexcept
+    {
+      U returnValue = 0;
+
+      if ( (a != 0) && (b != 0) )
+      {
+        a /= gcd_binary(a, b);
+        overflow = overflow || (b > std::numeric_limits<U>::max() / a);
+        returnValue = a * b;
+      };
+
+      return returnValue;
+    }
+
+  } // namespace detail
+
+  /// @brief      Element-wise greatest common divisor of two arrays. gcd(0, b) = |b|, gcd(0, 0) = 0.
+  /// @param[in]  a: The first values.
+  /// @param[in]  b: The second values.
+  /// @param[out] result: The greatest common divisors. (May alias a or b.)
+  /// @throws     std::invalid_argument if the arrays are not the same size.
+  /// @throws     std::overflow_error if any result is not representable in T, ie gcd(MIN, 0) or gcd(MIN, MIN) for signed
+  ///             T. (result is then incomplete)
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  void gcd(std::span<T const> a, std::span<T const> b, std::span<T> result)
+  {
+    static_assert(std::is_integral<T>::value, "Integer type required.");
+    using U = std::make_unsigned_t<T>;
+
+    std::atomic<bool> overflow = false;
+
+    if ( (a.size() != b.size()) || (a.size() != result.size()) )
+    {
+      throw std::invalid_argument("MCL::gcd - Arrays must be the same size.");
+    };
+
+    parallelFor(a.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      U u[detail::GCD_LANES];
+      U v[detail::GCD_LANES];
+      U limit = static_cast<U>(std::numeric_limits<T>::max());
+      bool threadOverflow = false;
+
+      for (std::size_t index = indexBegin; index < indexEnd; index += detail::GCD_LANES)
+      {
+        std::size_t n = std::min(detail::GCD_LANES, indexEnd - index);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          u[l] = detail::uabs(a[index + l]);
+          v[l] = detail::uabs(b[index + l]);
+        };
+
+        detail::gcdLanes(u, v, n);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          threadOverflow = threadOverflow || (u[l] > limit);
+          result[index + l] = static_cast<T>(u[l]);
+        };
+      };
+
+      if (threadOverflow)
+      {
+        overflow = true;
+      };
+    });
+
+    if (overflow)
+    {
+      throw std::overflow_error("MCL::gcd - Result not representable.");
+    };
+  }
+
+  /// @brief      Element-wise lowest common multiple of two arrays. lcm(0, b) = 0.
+  /// @param[in]  a: The first values.
+  /// @param[in]  b: The second values.
+  /// @param[out] result: The lowest common multiples. (May alias a or b.)
+  /// @throws     std::invalid_argument if the arrays are not the same size.
+  /// @throws     std::overflow_error if any result is not representable in T. (result is then incomplete)
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  void lcm(std::span<T const> a, std::span<T const> b, std::span<T> result)
+  {
+    static_assert(std::is_integral<T>::value, "Integer type required.");
+    using U = std::make_unsigned_t<T>;
+
+    std::atomic<bool> overflow = false;
+
+    if ( (a.size() != b.size()) || (a.size() != result.size()) )
+    {
+      throw std::invalid_argument("MCL::lcm - Arrays must be the same size.");
+    };
+
+    parallelFor(a.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      U u[detail::GCD_LANES];
+      U v[detail::GCD_LANES];
+      U g[detail::GCD_LANES];
+      bool threadOverflow = false;
+
+      for (std::size_t index = indexBegin; index < indexEnd; index += detail::GCD_LANES)
+      {
+        std::size_t n = std::min(detail::GCD_LANES, indexEnd - index);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          u[l] = g[l] = detail::uabs(a[index + l]);
+          v[l] = detail::uabs(b[index + l]);
+        };
+
+        detail::gcdLanes(g, v, n);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          U bv = detail::uabs(b[index + l]);
+          U av = (g[l] == 0) ? U{0} : u[l] / g[l];
+          U limit = static_cast<U>(std::numeric_limits<T>::max());
+
+          threadOverflow = threadOverflow || ( (av != 0) && (bv > limit / av) );
+          result[index + l] = static_cast<T>(av * bv);
+        };
+      };
+
+      if (threadOverflow)
+      {
+        overflow = true;
+      };
+    });
+
+    if (overflow)
+    {
+      throw std::overflow_error("MCL::lcm - Result not representable.");
+    };
+  }
+
+  /// @brief      Greatest common divisor of all the values in an array. Zero values are ignored.
+  /// @param[in]  a: The values.
+  /// @returns    The greatest common divisor. (0 if all values are zero or the array is empty.)
+  /// @throws     None.
+  /// @note       This function is multi-threaded. Each thread reduces its block in GCD_LANES independent lanes and stops
+  ///             early once all its lanes reach 1.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::make_unsigned_t<T> gcd(std::span<T const> a)
+  {
+    static_assert(std::is_integral<T>::value, "Integer type required.");
+    using U = std::make_unsigned_t<T>;
+
+    std::vector<U> gcds(threadCount(a.size()), 0);
+
+    parallelFor(a.size(), gcds.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+    {
+      U u[detail::GCD_LANES] = { };
+      U v[detail::GCD_LANES];
+
+      for (std::size_t index = indexBegin; index < indexEnd; index += detail::GCD_LANES)
+      {
+        std::size_t n = std::min(detail::GCD_LANES, indexEnd - index);
+        U allOne = 1;
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+          v[l] = detail::uabs(a[index + l]);
+        };
+
+        detail::gcdLanes(u, v, n);
+
+        for (std::size_t l = 0; l < detail::GCD_LANES; l++)
+        {
+          allOne &= (u[l] == 1);
+        };
+
+        if (allOne)
+        {
+          break;
+        };
+      };
+
+      U returnValue = 0;
+      for (std::size_t l = 0; l < detail::GCD_LANES; l++)
+      {
+        returnValue = detail::gcd_binary(returnValue, u[l]);
+      };
+      gcds[threadNumber] = returnValue;
+    });
+
+    U returnValue = 0;
+    for (auto const &g: gcds)
+    {
+      returnValue = detail::gcd_binary(returnValue, g);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Lowest common multiple of all the values in an array.
+  /// @param[in]  a: The values.
+  /// @returns    The lowest common multiple. (0 if any value is zero, 1 if the array is empty.)
+  /// @throws     std::overflow_error if the result is not representable.
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::make_unsigned_t<T> lcm(std::span<T const> a)
+  {
+    static_assert(std::is_integral<T>::value, "Integer type required.");
+    using U = std::make_unsigned_t<T>;
+
+    std::vector<U> lcms(threadCount(a.size()), 1);
+    std::vector<char> overflows(lcms.size(), 0);
+
+    parallelFor(a.size(), lcms.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+    {
+      U returnValue = 1;
+      bool overflow = false;
+
+      for (std::size_t index = indexBegin; (index < indexEnd) && (returnValue != 0) && !overflow; index++)
+      {
+        returnValue = detail::lcmChecked(returnValue, detail::uabs(a[index]), overflow);
+      };
+
+      lcms[threadNumber] = returnValue;
+      overflows[threadNumber] = overflow;
+    });
+
+    U returnValue = 1;
+    bool overflow = std::any_of(overflows.begin(), overflows.end(), [](char o) { return o != 0; });
+
+    for (auto const &l: lcms)
+    {
+      returnValue = detail::lcmChecked(returnValue, l, overflow);
+    };
+
+    if (overflow)
+    {
+      throw std::overflow_error("MCL::lcm - Result not representable.");
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Determines the lowest common denominator of an array of denominators.
+  /// @param[in]  denominators: The denominators. (Sign is ignored.)
+  /// @returns    The lowest common denominator.
+  /// @throws     std::invalid_argument if any denominator is zero.
+  /// @throws     std::overflow_error if the result is not representable in T.
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  T commonDenominator(std::span<T const> denominators)
+  {
+    auto returnValue = lcm(denominators);
+
+    if (returnValue == 0)
+    {
+      throw std::invalid_argument("MCL::commonDenominator - Denominator cannot be zero.");
+    }
+    else if (returnValue > static_cast<std::make_unsigned_t<T>>(std::numeric_limits<T>::max()))
+    {
+      throw std::overflow_error("MCL::commonDenominator - Result not representable.");
+    };
+
+    return static_cast<T>(returnValue);
+  }
+
+} // namespace MCL
+
+#endif // GCDARRAY_HPP
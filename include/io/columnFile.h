@@ -0,0 +1,235 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								columnFile
+// SUBSYSTEM:						Input/Output
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A binary file format for a numeric series. The values are stored in fixed size chunks, and a summary
+//                      (count, sum, M2, minimum, maximum) of each chunk is stored in a footer. The sum, mean, variance, minimum
+//                      and maximum of the series, or of a range of chunks, are answered from the footer without reading the
+//                      values.
+//                      All the fields are little-endian. The layout (version 1) is:
+//                        offset  0: char[8]   magic "MCLCOLMN"
+//                        offset  8: uint16    version
+//                        offset 10: int16     type (ENumericType)
+//                        offset 12: uint32    element size (bytes)
+//                        offset 16: uint64    chunk size (values per chunk)
+//                        offset 24: uint64    number of values
+//                        offset 32: uint64    offset of the footer
+//                        offset 40: values    chunk 0, chunk 1, ... (the last chunk may be shorter)
+//                        footer:    per chunk: uint64 count, double sum, double M2, double minimum, double maximum
+//                      The footer starts on an 8 byte boundary.
+//                      The reader maps the file, only the footer is read when the file is opened. The pages of a chunk are
+//                      read when the chunk is first accessed.
+//
+// CLASSES INCLUDED:    columnFile_t
+//
+// FUNCTIONS INCLUDED:  columnFileWrite(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_IO_COLUMNFILE_H
+#define MCL_IO_COLUMNFILE_H
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+  // MCL Library header files
+
+#include "../numeric.h"
+#include "../numericColumn.h"
+#include "../statistics/summary.hpp"
+#include "../utility/parallel.hpp"
+#include "mappedFile.h"
+
+namespace MCL
+{
+  std::uint16_t constexpr COLUMNFILE_VERSION = 1;
+  std::size_t constexpr COLUMNFILE_CHUNK = 65536;       ///< Default number of values per chunk.
+
+  namespace detail
+  {
+    std::size_t constexpr COLUMNFILE_HEADER = 40;         ///< Size of the header. (The offset of the first chunk.)
+    std::size_t constexpr COLUMNFILE_FOOTER = 40;         ///< Size of the footer entry of a chunk.
+
+    void columnFileWrite(std::filesystem::path const &, ENumericType, std::size_t, char const *, std::size_t, std::size_t,
+                         std::span<summary_t const>);
+    void byteSwap(char *, std::size_t, std::size_t) noexcept;
+  }
+
+  /// @brief      Writes a series of values to a column file.
+  /// @param[in]  path: The file to write. An existing file is replaced.
+  /// @param[in]  values: The values to write.
+  /// @param[in]  chunkSize: The number of values per chunk.
+  /// @throws     std::invalid_argument - chunkSize is zero.
+  /// @throws     std::system_error - The file cannot be written.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  void columnFileWrite(std::filesystem::path const &path, std::span<T const> values,
+                       std::size_t chunkSize = COLUMNFILE_CHUNK)
+  {
+    static_assert(numericType<T> != NT_none, "Unsupported numeric type.");
+
+    if (chunkSize == 0)
+    {
+      throw std::invalid_argument("MCL::columnFileWrite - Chunk size must be greater than zero.");
+    };
+
+    std::size_t chunkCount = values.size() / chunkSize + (values.size() % chunkSize != 0);
+    std::vector<summary_t> summaries(chunkCount);
+
+    parallelFor(chunkCount, [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      for (std::size_t chunk = indexBegin; chunk < indexEnd; chunk++)
+      {
+        summaries[chunk].add(values.subspan(chunk * chunkSize, std::min(chunkSize, values.size() - chunk * chunkSize)));
+      };
+    }, std::max(std::size_t{1}, 1000000 / chunkSize));
+
+    detail::columnFileWrite(path, numericType<T>, sizeof(T), reinterpret_cast<char const *>(values.data()), values.size(),
+                            chunkSize, summaries);
+  }
+
+  /// @brief      Writes the values of a column to a column file.
+  /// @param[in]  path: The file to write. An existing file is replaced.
+  /// @param[in]  column: The column to write.
+  /// @param[in]  chunkSize: The number of values per chunk.
+  /// @throws     std::invalid_argument - chunkSize is zero, or the column has no type.
+  /// @throws     std::system_error - The file cannot be written.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline void columnFileWrite(std::filesystem::path const &path, numericColumn_t const &column,
+                              std::size_t chunkSize = COLUMNFILE_CHUNK)
+  {
+    column.visit([&](auto values) { columnFileWrite(path, values, chunkSize); });
+  }
+
+  class columnFile_t
+  {
+  private:
+    mappedFile_t file_;
+    ENumericType type_ = NT_none;
+    std::size_t elementSize_ = 0;
+    std::size_t chunkSize_ = 0;
+    std::size_t count_ = 0;
+    std::vector<summary_t> summaries_;
+
+    void checkChunk(std::size_t) const;
+    template<typename T>
+    void checkType() const
+    {
+      if (numericType<T> != type_)
+      {
+        throw std::invalid_argument("MCL::columnFile_t - Type does not match the type of the file.");
+      };
+    }
+
+  protected:
+  public:
+    explicit columnFile_t(std::filesystem::path const &);
+    columnFile_t(columnFile_t const &) = delete;
+    columnFile_t(columnFile_t &&) noexcept = default;
+
+    columnFile_t &operator=(columnFile_t const &) = delete;
+    columnFile_t &operator=(columnFile_t &&) noexcept = default;
+
+    ENumericType type() const noexcept { return type_; }
+    std::size_t size() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0; }
+    std::size_t chunkSize() const noexcept { return chunkSize_; }
+    std::size_t chunkCount() const noexcept { return summaries_.size(); }
+    std::size_t chunkLength(std::size_t) const;
+
+    summary_t const &summary(std::size_t) const;
+    summary_t summary(std::size_t, std::size_t) const;
+    summary_t summary() const { return summary(0, chunkCount()); }
+
+    /// @brief      Returns a view of the values of a chunk. No copy is made.
+    /// @param[in]  chunk: The chunk number.
+    /// @returns    A span of the values. The span is valid while the file is open.
+    /// @throws     std::out_of_range - Invalid chunk number.
+    /// @throws     std::invalid_argument - T is not the type of the file.
+    /// @throws     std::runtime_error - The host is not little-endian. (Use read().)
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    std::span<T const> view(std::size_t chunk) const
+    {
+      checkChunk(chunk);
+      checkType<T>();
+
+      if constexpr (std::endian::native != std::endian::little)
+      {
+        throw std::runtime_error("MCL::columnFile_t - Views require a little-endian host.");
+      };
+
+      T const *values = reinterpret_cast<T const *>(file_.data().data() + detail::COLUMNFILE_HEADER);
+
+      return std::span<T const>(values + chunk * chunkSize_, chunkLength(chunk));
+    }
+
+    /// @brief      Copies the values of a chunk. The values are converted to the byte order of the host.
+    /// @param[in]  chunk: The chunk number.
+    /// @returns    The values.
+    /// @throws     std::out_of_range - Invalid chunk number.
+    /// @throws     std::invalid_argument - T is not the type of the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    std::vector<T> read(std::size_t chunk) const
+    {
+      checkChunk(chunk);
+      checkType<T>();
+
+      std::vector<T> values(chunkLength(chunk));
+
+      std::memcpy(values.data(), file_.data().data() + detail::COLUMNFILE_HEADER + chunk * chunkSize_ * sizeof(T),
+                  values.size() * sizeof(T));
+
+      if constexpr (std::endian::native != std::endian::little)
+      {
+        detail::byteSwap(reinterpret_cast<char *>(values.data()), values.size(), sizeof(T));
+      };
+
+      return values;
+    }
+  };
+
+}   // namespace MCL
+
+#endif // MCL_IO_COLUMNFILE_H
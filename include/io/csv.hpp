@@ -0,0 +1,415 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								csv
+// SUBSYSTEM:						Input/Output
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Parsing of a numeric column from CSV text. The text is normally a mappedFile_t.
+//                      The text is split into one chunk per thread at line boundaries, and each chunk is parsed with
+//                      std::from_chars directly from the text. csvRead() writes the values straight into the output array;
+//                      csvForEachBlock() passes blocks of values to a function (for example a summary_t accumulator) without
+//                      storing the column.
+//                      Lines are terminated by '\n' (a trailing '\r' is ignored). Blank lines are skipped. Spaces and tabs
+//                      around a value are ignored. Quoted fields are not supported.
+//
+// CLASSES INCLUDED:    csvOptions_t
+//
+// FUNCTIONS INCLUDED:  csvRead(...)
+//                      csvForEachBlock(...)
+//                      csvSummary(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_IO_CSV_HPP
+#define MCL_IO_CSV_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+  // MCL library header files.
+
+#include "mappedFile.h"
+#include "../statistics/summary.hpp"
+#include "../utility/parallel.hpp"
+
+namespace MCL
+{
+  struct csvOptions_t
+  {
+    std::size_t column = 0;         ///< Index of the column to read. (0 = first column)
+    std::size_t skipLines = 0;      ///< Number of lines (headers) to skip.
+    char delimiter = ',';           ///< Field delimiter.
+  };
+
+  namespace detail
+  {
+    std::size_t constexpr CSV_GRAIN = 1 << 20;      ///< Minimum number of bytes per thread.
+    std::size_t constexpr CSV_BLOCK = 4096;         ///< Number of values passed per block by csvForEachBlock.
+
+    /// @brief A part of the text that is parsed by one thread. The chunk starts at the beginning of a line.
+
+    struct csvChunk_t
+    {
+      char const *begin;
+      char const *end;
+      std::size_t firstLine;      ///< Line number (1 based) of the first line of the chunk.
+      std::size_t newlines;       ///< Number of newlines in the chunk.
+      std::size_t errorLine;      ///< Line number of the first invalid line. 0 if there is no error.
+    };
+
+    /// @brief      Splits the text into chunks at line boundaries, after skipping the header lines.
+    /// @param[in]  text: The text.
+    /// @param[in]  options: The parsing options.
+    /// @returns    The chunks. One per thread.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    inline std::vector<csvChunk_t> csvSplit(std::span<char const> text, csvOptions_t const &options)
+    {
+      char const *first = text.data();
+      char const *last = text.data() + text.size();
+      std::size_t line = 1;
+
+      for (std::size_t skip = 0; (skip < options.skipLines) && (first != last); skip++, line++)
+      {
+        char const *eol = static_cast<char const *>(std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+        first = (eol == nullptr) ? last : eol + 1;
+      };
+
+      std::size_t numberOfChunks = threadCount(static_cast<std::size_t>(last - first), CSV_GRAIN);
+      std::size_t stepSize = static_cast<std::size_t>(last - first) / numberOfChunks;
+      std::vector<csvChunk_t> chunks;
+
+      chunks.reserve(numberOfChunks);
+
+      for (std::size_t chunk = 0; chunk < numberOfChunks; chunk++)
+      {
+        char const *end = last;
+
+        if (chunk != numberOfChunks - 1)
+        {
+          end = std::min(first + stepSize, last);
+          char const *eol = static_cast<char const *>(std::memchr(end, '\n', static_cast<std::size_t>(last - end)));
+          end = (eol == nullptr) ? last : eol + 1;
+        };
+
+        chunks.push_back(csvChunk_t{ first, end, line, 0, 0 });
+        first = end;
+      };
+
+        // Number the lines.
+
+      parallelFor(chunks.size(), [&chunks](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t chunk = indexBegin; chunk < indexEnd; chunk++)
+        {
+          chunks[chunk].newlines = static_cast<std::size_t>(std::count(chunks[chunk].begin, chunks[chunk].end, '\n'));
+        };
+      }, 1);
+
+      for (std::size_t chunk = 1; chunk < chunks.size(); chunk++)
+      {
+        chunks[chunk].firstLine = chunks[chunk - 1].firstLine + chunks[chunk - 1].newlines;
+      };
+
+      return chunks;
+    }
+
+    /// @brief      Parses the lines of a chunk, calling fn(value) for each value.
+    /// @param[in]  chunk: The chunk to parse. The error line is updated.
+    /// @param[in]  options: The parsing options.
+    /// @param[in]  fn: Called with each value.
+    /// @throws     None. (Errors are recorded in the chunk)
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T, typename F>
+    void csvParseChunk(csvChunk_t &chunk, csvOptions_t const &options, F &&fn) noexcept
+    {
+      auto isSpace = [](char c) { return (c == ' ') || (c == '\t') || (c == '\r'); };
+      char const *p = chunk.begin;
+      char const *last = chunk.end;
+      std::size_t line = chunk.firstLine;
+
+      for (; p != last; line++)
+      {
+        char const *eol = static_cast<char const *>(std::memchr(p, '\n', static_cast<std::size_t>(last - p)));
+        char const *lineEnd = (eol == nullptr) ? last : eol;
+        char const *field = p;
+
+        p = (eol == nullptr) ? last : eol + 1;
+
+        while ( (field != lineEnd) && isSpace(*field) )
+        {
+          field++;
+        };
+        if (field == lineEnd)
+        {
+          continue;       // Blank line.
+        };
+
+        for (std::size_t column = 0; column < options.column; column++)
+        {
+          char const *delimiter = static_cast<char const *>(std::memchr(field, options.delimiter,
+                                                                         static_cast<std::size_t>(lineEnd - field)));
+          if (delimiter == nullptr)
+          {
+            chunk.errorLine = line;
+            return;
+          };
+          field = delimiter + 1;
+        };
+
+        while ( (field != lineEnd) && isSpace(*field) )
+        {
+          field++;
+        };
+
+        T value;
+        std::from_chars_result result = std::from_chars(field, lineEnd, value);
+        char const *next = result.ptr;
+
+        while ( (next != lineEnd) && isSpace(*next) )
+        {
+          next++;
+        };
+
+        if ( (result.ec != std::errc()) || ((next != lineEnd) && (*next != options.delimiter)) )
+        {
+          chunk.errorLine = line;
+          return;
+        };
+
+        fn(value);
+      };
+    }
+
+    /// @brief      Parses the chunks in parallel, one thread per chunk, passing the values to a function in blocks.
+    /// @param[in]  chunks: The chunks to parse. The error lines are updated.
+    /// @param[in]  options: The parsing options.
+    /// @param[in]  fn: fn(std::span<T const> block, std::size_t threadNumber). threadNumber is the index of the chunk.
+    /// @throws     None. (Errors are recorded in the chunks)
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T, typename F>
+    void csvParseBlocks(std::vector<csvChunk_t> &chunks, csvOptions_t const &options, F &fn)
+    {
+      parallelFor(chunks.size(), chunks.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+      {
+        T block[CSV_BLOCK];
+        std::size_t count = 0;
+
+        for (std::size_t chunk = indexBegin; chunk < indexEnd; chunk++)
+        {
+          csvParseChunk<T>(chunks[chunk], options, [&](T value)
+          {
+            block[count++] = value;
+            if (count == CSV_BLOCK)
+            {
+              fn(std::span<T const>(block, count), threadNumber);
+              count = 0;
+            };
+          });
+        };
+
+        if (count != 0)
+        {
+          fn(std::span<T const>(block, count), threadNumber);
+        };
+      });
+    }
+
+    /// @brief      Throws if a chunk has an error. The first error in the text is reported.
+    /// @throws     std::runtime_error
+
+    inline void csvCheckErrors(std::vector<csvChunk_t> const &chunks, char const *function)
+    {
+      for (csvChunk_t const &chunk : chunks)
+      {
+        if (chunk.errorLine != 0)
+        {
+          throw std::runtime_error(std::string("MCL::") + function + " - Invalid value at line " +
+                                   std::to_string(chunk.errorLine) + ".");
+        };
+      };
+    }
+  }   // namespace detail
+
+  /// @brief      Parses a numeric column from CSV text. The chunks are parsed in parallel, directly into the result.
+  /// @tparam     T: The type of the values. (Any type supported by std::from_chars.)
+  /// @param[in]  text: The CSV text.
+  /// @param[in]  options: The column, number of header lines and delimiter.
+  /// @returns    The values of the column.
+  /// @throws     std::runtime_error - Invalid value or missing column. The message gives the line number.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::vector<T> csvRead(std::span<char const> text, csvOptions_t const &options = {})
+  {
+    std::vector<detail::csvChunk_t> chunks = detail::csvSplit(text, options);
+    std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+    std::vector<std::size_t> counts(chunks.size(), 0);
+
+      // Each line holds at most one value, so the newline count of each chunk bounds the number of values.
+
+    for (std::size_t chunk = 0; chunk < chunks.size(); chunk++)
+    {
+      offsets[chunk + 1] = offsets[chunk] + chunks[chunk].newlines + 1;
+    };
+
+    std::vector<T> returnValue(offsets.back());
+
+    parallelFor(chunks.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      for (std::size_t chunk = indexBegin; chunk < indexEnd; chunk++)
+      {
+        T *out = returnValue.data() + offsets[chunk];
+
+        detail::csvParseChunk<T>(chunks[chunk], options, [&out](T value) { *out++ = value; });
+        counts[chunk] = static_cast<std::size_t>(out - (returnValue.data() + offsets[chunk]));
+      };
+    }, 1);
+
+    detail::csvCheckErrors(chunks, "csvRead");
+
+      // Close the gaps left by blank lines and the unused last slot of each chunk.
+
+    std::size_t size = counts[0];
+    for (std::size_t chunk = 1; chunk < chunks.size(); chunk++)
+    {
+      std::copy(returnValue.begin() + offsets[chunk], returnValue.begin() + offsets[chunk] + counts[chunk],
+                returnValue.begin() + size);
+      size += counts[chunk];
+    };
+    returnValue.resize(size);
+
+    return returnValue;
+  }
+
+  /// @brief      Parses a numeric column from a CSV file. The file is memory mapped.
+  /// @tparam     T: The type of the values.
+  /// @param[in]  path: The file.
+  /// @param[in]  options: The column, number of header lines and delimiter.
+  /// @returns    The values of the column.
+  /// @throws     std::system_error - Unable to open the file.
+  /// @throws     std::runtime_error - Invalid value or missing column.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::vector<T> csvRead(std::filesystem::path const &path, csvOptions_t const &options = {})
+  {
+    mappedFile_t file(path);
+
+    return csvRead<T>(file.data(), options);
+  }
+
+  /// @brief      Parses a numeric column from CSV text, passing the values to a function in blocks. The column is not
+  ///             stored. The chunks are parsed in parallel and fn is called concurrently from the threads; the blocks of
+  ///             each thread are in file order.
+  /// @tparam     T: The type of the values.
+  /// @param[in]  text: The CSV text.
+  /// @param[in]  options: The column, number of header lines and delimiter.
+  /// @param[in]  fn: fn(std::span<T const> block, std::size_t threadNumber). Must not throw.
+  /// @returns    The number of threads used. (threadNumber is in [0; returnValue))
+  /// @throws     std::runtime_error - Invalid value or missing column. (fn has been called for the values before the error.)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T, typename F>
+  std::size_t csvForEachBlock(std::span<char const> text, csvOptions_t const &options, F fn)
+  {
+    std::vector<detail::csvChunk_t> chunks = detail::csvSplit(text, options);
+
+    detail::csvParseBlocks<T>(chunks, options, fn);
+    detail::csvCheckErrors(chunks, "csvForEachBlock");
+
+    return chunks.size();
+  }
+
+  /// @brief      Calculates the summary statistics (count, sum, min, max, mean, variance) of a CSV column without storing
+  ///             the column.
+  /// @tparam     T: The type of the values.
+  /// @param[in]  text: The CSV text.
+  /// @param[in]  options: The column, number of header lines and delimiter.
+  /// @returns    The summary of the column.
+  /// @throws     std::runtime_error - Invalid value or missing column.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  summary_t csvSummary(std::span<char const> text, csvOptions_t const &options = {})
+  {
+    std::vector<detail::csvChunk_t> chunks = detail::csvSplit(text, options);
+    std::vector<summary_t> summaries(chunks.size());
+    summary_t returnValue;
+
+    auto fn = [&summaries](std::span<T const> block, std::size_t threadNumber)
+    {
+      summaries[threadNumber].add(block);
+    };
+
+    detail::csvParseBlocks<T>(chunks, options, fn);
+    detail::csvCheckErrors(chunks, "csvSummary");
+
+    for (summary_t const &summary : summaries)
+    {
+      returnValue.merge(summary);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Calculates the summary statistics of a column of a CSV file. The file is memory mapped.
+  /// @tparam     T: The type of the values.
+  /// @param[in]  path: The file.
+  /// @param[in]  options: The column, number of header lines and delimiter.
+  /// @returns    The summary of the column.
+  /// @throws     std::system_error - Unable to open the file.
+  /// @throws     std::runtime_error - Invalid value or missing column.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  summary_t csvSummary(std::filesystem::path const &path, csvOptions_t const &options = {})
+  {
+    mappedFile_t file(path);
+
+    return csvSummary<T>(file.data(), options);
+  }
+
+} // namespace MCL
+
+#endif // MCL_IO_CSV_HPP
@@ -0,0 +1,76 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								mappedFile
+// SUBSYSTEM:						Input/Output
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A read only view of a file. On POSIX systems the file is memory mapped, on other systems it is read into
+//                      memory.
+//
+// CLASSES INCLUDED:    mappedFile_t
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_IO_MAPPEDFILE_H
+#define MCL_IO_MAPPEDFILE_H
+
+  // Standard C++ library header files
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace MCL
+{
+  class mappedFile_t
+  {
+  private:
+    char const *data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;                     ///< true if data_ is a mapping, false if it points into buffer_.
+    std::vector<char> buffer_;
+
+    void release() noexcept;
+
+  protected:
+  public:
+    mappedFile_t() = default;
+    explicit mappedFile_t(std::filesystem::path const &);
+    mappedFile_t(mappedFile_t const &) = delete;
+    mappedFile_t(mappedFile_t &&) noexcept;
+    ~mappedFile_t();
+
+    mappedFile_t &operator=(mappedFile_t const &) = delete;
+    mappedFile_t &operator=(mappedFile_t &&) noexcept;
+
+    std::span<char const> data() const noexcept { return std::span<char const>(data_, size_); }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+  };
+
+}   // namespace MCL
+
+#endif // MCL_IO_MAPPEDFILE_H
@@ -10,7 +10,7 @@
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
 //
-//                      Copyright 2015, 2017-2022 Gavin Blakeman.
+//                      Copyright 2015, 2017-2022, 2026 Gavin Blakeman.
 //                      This file is part of the Maths Class Library (MCL)
 //
 //                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
@@ -26,7 +26,8 @@
 //
 // OVERVIEW:            The CNumeric class provides a class with a type that can be selected on the fly.
 //
-// HISTORY:             2015-09-22 GGB - astroManager 2015.09 release
+// HISTORY:             2026-10-19 GGB - Added table driven checked conversions and bulk conversion.
+//                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2015-07-07 GGB - File Created.
 //
 //**********************************************************************************************************************************
@@ -38,6 +39,9 @@
 
 #include <cstdint>
 #include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
   // MCL Library
 
@@ -60,6 +64,92 @@ namespace MCL
     NT_double = -64
   };
 
+  /// @brief Maps an arithmetic type onto the matching ENumericType value. (NT_none for unsupported types.)
+
+  template<typename T> inline constexpr ENumericType numericType = NT_none;
+  template<> inline constexpr ENumericType numericType<std::uint8_t> = NT_uint8;
+  template<> inline constexpr ENumericType numericType<std::uint16_t> = NT_uint16;
+  template<> inline constexpr ENumericType numericType<std::uint32_t> = NT_uint32;
+  template<> inline constexpr ENumericType numericType<std::uint64_t> = NT_uint64;
+  template<> inline constexpr ENumericType numericType<std::int8_t> = NT_int8;
+  template<> inline constexpr ENumericType numericType<std::int16_t> = NT_int16;
+  template<> inline constexpr ENumericType numericType<std::int32_t> = NT_int32;
+  template<> inline constexpr ENumericType numericType<std::int64_t> = NT_int64;
+  template<> inline constexpr ENumericType numericType<float> = NT_float;
+  template<> inline constexpr ENumericType numericType<double> = NT_double;
+
+  /// @brief Status returned by the checked (non-throwing) conversions. The values are bit flags so that the status of a number
+  ///        of conversions can be combined with |.
+
+  enum conversionStatus_e
+  {
+    CS_OK = 0,              ///< Value converted.
+    CS_RANGE = 1,           ///< Value out of range for the destination type.
+    CS_NOVALUE = 2,         ///< No value stored. (NT_none)
+  };
+
+  /// @brief      Checked conversion between two arithmetic types.
+  /// @param[in]  s: The source value.
+  /// @param[out] d: The converted value. Set to zero if the value is out of range.
+  /// @returns    CS_OK or CS_RANGE.
+  /// @throws     None.
+  /// @note       Floating point to integer conversions truncate. Infinities and NaN are representable as float, but not as
+  ///             an integer.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename S, typename D>
+  constexpr conversionStatus_e numericConvert(S s, D &d) noexcept
+  {
+    static_assert(std::is_arithmetic<S>::value && std::is_arithmetic<D>::value, "Arithmetic types required.");
+
+    bool inRange;
+
+    if constexpr (std::is_floating_point<D>::value)
+    {
+      if constexpr (std::is_floating_point<S>::value && (sizeof(S) > sizeof(D)))
+      {
+        inRange = !( (s - s == 0) &&
+                     ((s > std::numeric_limits<D>::max()) || (s < std::numeric_limits<D>::lowest())) );
+      }
+      else
+      {
+        inRange = true;
+      };
+      d = inRange ? static_cast<D>(s) : D{0};
+    }
+    else if constexpr (std::is_floating_point<S>::value)
+    {
+      if constexpr (std::numeric_limits<D>::digits <= std::numeric_limits<S>::digits)
+      {
+          // The maximum of D is exactly representable. Values above it (255.5 for uint8_t) are out of range.
+
+        inRange = (s >= static_cast<S>(std::numeric_limits<D>::lowest())) && (s <= static_cast<S>(std::numeric_limits<D>::max()));
+      }
+      else
+      {
+          // The maximum of D rounds up to 2^digits, which is exactly representable. There are no values of S between the
+          // maximum and 2^digits.
+
+        S constexpr upper = static_cast<S>(std::numeric_limits<D>::max() / 2 + 1) * 2;
+
+        inRange = (s >= static_cast<S>(std::numeric_limits<D>::lowest())) && (s < upper);
+      };
+      d = static_cast<D>(inRange ? s : S{0});
+    }
+    else
+    {
+      inRange = std::in_range<D>(s);
+      d = inRange ? static_cast<D>(s) : D{0};
+    };
+
+    return inRange ? CS_OK : CS_RANGE;
+  }
+
+  class CNumeric;
+
+  template<typename D>
+  conversionStatus_e convert(std::span<CNumeric const>, std::span<D>) noexcept;
+
   class CNumeric
   {
   private:
@@ -80,6 +170,9 @@ namespace MCL
     UValue value;
     ENumericType storedType;
 
+    template<typename D>
+    D checkedValue() const;
+
   protected:
   public:
     CNumeric();
@@ -107,6 +200,13 @@ namespace MCL
     operator float() const;
     operator double() const;
 
+    ENumericType type() const noexcept { return storedType; }
+
+    template<typename D>
+    conversionStatus_e convert(D &) const noexcept;
+
+    template<typename D>
+    friend conversionStatus_e convert(std::span<CNumeric const>, std::span<D>) noexcept;
   };
 
 } // namespace MCL
@@ -0,0 +1,241 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								numericColumn
+// SUBSYSTEM:						Numeric classes.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            The numericColumn_t class is the bulk counterpart of CNumeric. The type is selected on the fly, but is
+//                      stored once for the column, and the values are stored contiguously at their natural width. The values
+//                      can be viewed as a std::span<T> without copying, so the statistics functions can be used directly on
+//                      the column.
+//
+// CLASSES INCLUDED:    numericColumn_t
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#ifndef NUMERICCOLUMN_H
+#define NUMERICCOLUMN_H
+
+  // Standard C++ library header files.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+  // MCL Library
+
+#include "numeric.h"
+#include "utility/parallel.hpp"
+
+namespace MCL
+{
+  class numericColumn_t
+  {
+  private:
+    using storage_t = std::variant<std::monostate,
+                                   std::vector<std::uint8_t>, std::vector<std::uint16_t>,
+                                   std::vector<std::uint32_t>, std::vector<std::uint64_t>,
+                                   std::vector<std::int8_t>, std::vector<std::int16_t>,
+                                   std::vector<std::int32_t>, std::vector<std::int64_t>,
+                                   std::vector<float>, std::vector<double>>;
+
+    storage_t storage;
+
+  protected:
+  public:
+    numericColumn_t() = default;
+    numericColumn_t(ENumericType, std::size_t = 0);
+
+    /// @brief      Constructs a column from an array of values. The type of the column is the type of the values.
+    /// @param[in]  values: The values to copy into the column.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    explicit numericColumn_t(std::span<T const> values)
+      : storage(std::in_place_type<std::vector<T>>, values.begin(), values.end())
+    {
+      static_assert(numericType<T> != NT_none, "Unsupported numeric type.");
+    }
+
+    numericColumn_t(numericColumn_t const &) = default;
+    numericColumn_t(numericColumn_t &&) noexcept = default;
+    numericColumn_t &operator=(numericColumn_t const &) = default;
+    numericColumn_t &operator=(numericColumn_t &&) noexcept = default;
+
+    ENumericType type() const noexcept;
+    std::size_t size() const noexcept;
+    bool empty() const noexcept { return size() == 0; }
+    std::size_t elementSize() const noexcept;
+
+    void resize(std::size_t);
+    void reserve(std::size_t);
+    void clear() noexcept;
+
+    CNumeric at(std::size_t) const;
+
+    /// @brief      Appends a value to the column. The value is converted to the type of the column.
+    /// @param[in]  value: The value to append.
+    /// @returns    CS_OK, CS_RANGE (zero appended) or CS_NOVALUE (column has no type, nothing appended).
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    conversionStatus_e push_back(T value)
+    {
+      return std::visit([&](auto &v)
+      {
+        if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+        {
+          return CS_NOVALUE;
+        }
+        else
+        {
+          typename std::decay_t<decltype(v)>::value_type converted;
+          conversionStatus_e status = numericConvert(value, converted);
+
+          v.push_back(converted);
+          return status;
+        };
+      }, storage);
+    }
+
+    /// @brief      Returns a view of the values. No copy is made.
+    /// @returns    A span of the values. The span is invalidated if the column is resized.
+    /// @throws     std::invalid_argument - T is not the type of the column.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    std::span<T> view()
+    {
+      if (std::vector<T> *v = std::get_if<std::vector<T>>(&storage))
+      {
+        return std::span<T>(*v);
+      }
+      else
+      {
+        throw std::invalid_argument("numericColumn_t: View type does not match the column type.");
+      };
+    }
+
+    /// @brief      Returns a read only view of the values. No copy is made.
+    /// @returns    A span of the values. The span is invalidated if the column is resized.
+    /// @throws     std::invalid_argument - T is not the type of the column.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    std::span<T const> view() const
+    {
+      if (std::vector<T> const *v = std::get_if<std::vector<T>>(&storage))
+      {
+        return std::span<T const>(*v);
+      }
+      else
+      {
+        throw std::invalid_argument("numericColumn_t: View type does not match the column type.");
+      };
+    }
+
+    /// @brief      Calls fn with a view of the values of the stored type. This allows a function template (or generic lambda)
+    ///             to be run on the column without a type dispatch per value.
+    /// @param[in]  fn: The function to call. fn(std::span<T const>) must be valid, and return the same type, for all the
+    ///             numeric types.
+    /// @returns    The value returned by fn.
+    /// @throws     std::invalid_argument - The column has no type.
+    /// @throws     Any exception thrown by fn.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename F>
+    auto visit(F &&fn) const
+    {
+      using result_t = decltype(fn(std::span<double const>()));
+
+      return std::visit([&](auto const &v) -> result_t
+      {
+        if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+        {
+          throw std::invalid_argument("numericColumn_t: Column has no type.");
+        }
+        else
+        {
+          return fn(std::span<typename std::decay_t<decltype(v)>::value_type const>(v));
+        };
+      }, storage);
+    }
+
+    /// @brief      Converts all the values in the column to the type D. The type is dispatched once for the column and the
+    ///             conversion loop is run over blocks of the column on separate threads.
+    /// @param[out] dest: The converted values. Values that are out of range are set to zero.
+    /// @returns    The status of all the conversions combined.
+    /// @throws     std::bad_alloc
+    /// @note       If dest is smaller than the column, only dest.size() values are converted.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename D>
+    conversionStatus_e convert(std::span<D> dest) const
+    {
+      return std::visit([&](auto const &v)
+      {
+        if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+        {
+          return dest.empty() ? CS_OK : CS_NOVALUE;
+        }
+        else
+        {
+          std::size_t count = std::min(v.size(), dest.size());
+          std::vector<int> status(threadCount(count), CS_OK);
+
+          parallelFor(count, status.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+          {
+            int threadStatus = CS_OK;
+
+            for (std::size_t index = indexBegin; index < indexEnd; index++)
+            {
+              threadStatus |= numericConvert(v[index], dest[index]);
+            };
+            status[threadNumber] = threadStatus;
+          });
+
+          int returnValue = CS_OK;
+          for (int s : status)
+          {
+            returnValue |= s;
+          };
+          return static_cast<conversionStatus_e>(returnValue);
+        };
+      }, storage);
+    }
+
+    conversionStatus_e convert(numericColumn_t &) const;
+  };
+
+} // namespace MCL
+
+#endif // NUMERICCOLUMN_H
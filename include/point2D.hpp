@@ -29,7 +29,8 @@
 // CLASSES INCLUDED:    TPoint2D
 //
 //
-// HISTORY:             2015-09-22 GGB - astroManager 2015.09 release
+// HISTORY:             2026-10-19 GGB - Made constexpr, noexcept and trivially copyable. Removed the virtual operator-.
+//                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2013-09-30 GGB - astroManager 2013.09 release.
 //                      2013-06-08 GGB - Replaced typecast long and typecast double with a templated function.
 //                      2013-03-22 GGB - astroManager 2013.03 release.
@@ -41,9 +42,14 @@
 #ifndef MCL_POINT2D_H
 #define MCL_POINT2D_H
 
+  // Standard C++ library header files.
+
+#include <type_traits>
+
 #ifndef __EMBEDDED__
+#include <ostream>
+
 #include "exceptions.h"
-#include <GCL>
 #endif
 
 namespace MCL
@@ -52,52 +58,121 @@ namespace MCL
   class point2D
   {
   public:
-    inline point2D() = default;
-    inline point2D(point2D const &) = default;
-    inline point2D(point2D &&) = default;
-    inline point2D(T const &newX, T const &newY) : xVal(newX), yVal(newY) {}
+    constexpr point2D() noexcept = default;
+    constexpr point2D(point2D const &) noexcept = default;
+    constexpr point2D(point2D &&) noexcept = default;
+    constexpr point2D(T const &newX, T const &newY) noexcept : xVal(newX), yVal(newY) {}
 
-    inline point2D &operator=(point2D const &) = default;
-    inline point2D &operator=(point2D &&) = default;
+    constexpr point2D &operator=(point2D const &) noexcept = default;
+    constexpr point2D &operator=(point2D &&) noexcept = default;
 
-    inline T X() const noexcept { return xVal; }
-    inline T &X() noexcept { return xVal; }
-    inline T Y() const noexcept { return yVal; }
-    inline T &Y() noexcept { return yVal; }
+    constexpr T X() const noexcept { return xVal; }
+    constexpr T &X() noexcept { return xVal; }
+    constexpr T Y() const noexcept { return yVal; }
+    constexpr T &Y() noexcept { return yVal; }
 
 
-    bool operator==(point2D const &rhs) const { return ((xVal == rhs.xVal) && (yVal == rhs.yVal)); }
+    constexpr bool operator==(point2D const &rhs) const noexcept { return ((xVal == rhs.xVal) && (yVal == rhs.yVal)); }
 
     /// @brief Unitary negative operator
     /// @returns An instance containing the negative of the point. (-x, -y)
-    /// @throws
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Corrected the return type. (TPoint2D no longer exists)
+
+    constexpr point2D operator-() const noexcept
+    {
+      return point2D(-xVal, -yVal);
+    }
+
+    /// @brief Addition operator.
+    /// @param[in] rhs: The point to add.
+    /// @returns The sum of the points.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
+
+    constexpr point2D operator+(point2D const &rhs) const noexcept
+    {
+      return point2D(xVal + rhs.xVal, yVal + rhs.yVal);
+    }
+
+    /// @brief Subtraction operator.
+    /// @param[in] rhs: The right hand value to subtract.
+    /// @returns Object representing the difference of the values.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Made constexpr noexcept and non-virtual.
+    /// @version 2011-08-28/GGB - Function created
+
+    constexpr point2D operator-(point2D const &rhs) const noexcept
+    {
+      return point2D(xVal - rhs.xVal, yVal - rhs.yVal);
+    }
+
+    /// @brief Addition assignment operator.
+    /// @param[in] rhs: The point to add.
+    /// @returns *this
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
 
-    point2D operator-() const
+    constexpr point2D &operator+=(point2D const &rhs) noexcept
     {
-      return TPoint2D(-xVal, -yVal);
+      xVal += rhs.xVal;
+      yVal += rhs.yVal;
+
+      return *this;
+    }
+
+    /// @brief Subtraction assignment operator.
+    /// @param[in] rhs: The point to subtract.
+    /// @returns *this
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Removed the self assignment branch. (x - x == 0)
+    /// @version 2011-08-28/GGB - Function created.
+
+    constexpr point2D &operator-=(point2D const &rhs) noexcept
+    {
+      xVal -= rhs.xVal;
+      yVal -= rhs.yVal;
+
+      return *this;
     }
 
-    point2D &operator-=(point2D const &);
+    /// @brief Multiplication assignment operator.
+    /// @param[in] rhs: The value to multiply by.
+    /// @returns *this
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Return a reference.
+    /// @version 2014-03-07/GGB - Function created.
 
-    point2D<T> operator*=(double const &);
-    point2D<T> operator*(double const &) const;
+    constexpr point2D &operator*=(double const &rhs) noexcept
+    {
+      xVal *= rhs;
+      yVal *= rhs;
+
+      return *this;
+    }
+
+    /// @brief Multiplication function.
+    /// @param[in] rhs: The value to multiply by.
+    /// @throws None.
+    /// @version 2014-03-07/GGB - Function created.
+
+    constexpr point2D operator*(double const &rhs) const noexcept
+    {
+      return point2D(*this) *= rhs;
+    }
 
     /// @brief Division operator
     /// @param[in] divisor: The divisor to apply.
-    /// @returns The point divided by the divisor.
+    /// @returns The point divided by the divisor. A zero divisor returns (0, 0).
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Made constexpr noexcept. A zero divisor returns (0, 0) rather than raising an error message.
 
     template<typename U>
-    point2D operator /(U divisor)
+    constexpr point2D operator /(U divisor) const noexcept
     {
       point2D<T> retVal;
 
-      if (divisor == 0)
-      {
-#ifndef __EMBEDDED__
-        ERRORMESSAGE("NUMERIC: Value out of range.");
-#endif
-      }
-      else
+      if (divisor != 0)
       {
         retVal.xVal = (T) (static_cast<double>(xVal) / static_cast<double>(divisor));
         retVal.yVal = (T) (static_cast<double>(yVal) / static_cast<double>(divisor));
@@ -106,33 +181,26 @@ namespace MCL
       return retVal;
     }
 
-    virtual point2D operator-(const point2D &);
-
     /// @brief Typecast operator
     /// @returns The value typecast to the new type.
     /// @throws None.
 
     template<typename U>
-    operator point2D<U>() const
+    constexpr operator point2D<U>() const noexcept
     {
-      point2D<U> returnValue;
-
-      returnValue.x() = (U) xVal;
-      returnValue.y() = (U) yVal;
-
-      return returnValue;
+      return point2D<U>((U) xVal, (U) yVal);
     }
 
-    inline void x(T nv) { xVal = nv; }
-    inline void y(T nv) { yVal = nv; }
+    constexpr void x(T nv) noexcept { xVal = nv; }
+    constexpr void y(T nv) noexcept { yVal = nv; }
 
-    inline T const &x() const { return xVal;}
-    inline T const &y() const { return yVal;}
+    constexpr T const &x() const noexcept { return xVal;}
+    constexpr T const &y() const noexcept { return yVal;}
 
-    inline T &x() { return xVal;}
-    inline T &y() { return yVal;}
+    constexpr T &x() noexcept { return xVal;}
+    constexpr T &y() noexcept { return yVal;}
 
-    inline point2D &set(T _x, T _y) { xVal = _x; yVal = _y; return *this;}
+    constexpr point2D &set(T _x, T _y) noexcept { xVal = _x; yVal = _y; return *this;}
 
 #ifndef __EMBEDDED__
     template<typename U>
@@ -146,7 +214,7 @@ namespace MCL
     /// @throws None.
     /// @version 2017-09-23/GGB - Function created.
 
-    void operator()(T const &x, T const &y)
+    constexpr void operator()(T const &x, T const &y) noexcept
     {
       xVal = x;
       yVal = y;
@@ -157,7 +225,7 @@ namespace MCL
     /// @throws None.
 
     template<typename U>
-    point2D &operator +=(U rhs)
+    constexpr point2D &operator +=(U rhs) noexcept
     {
       xVal += static_cast<T>(rhs);
       yVal += static_cast<T>(rhs);
@@ -171,7 +239,7 @@ namespace MCL
     /// @version 2020-03-01/GGB - Function created.
 
     template<typename U>
-    point2D operator+(U rhs)
+    constexpr point2D operator+(U rhs) const noexcept
     {
       point2D temp = *this;
       temp += rhs;
@@ -179,44 +247,23 @@ namespace MCL
     }
 
   private:
-    T xVal;
-    T yVal;
+    T xVal = 0;
+    T yVal = 0;
 
   };  // class TPoint2D.
 
-
-  /// @brief Subtraction operator.
-  /// @param[in] rhs: The right hand value to add.
-  /// @returns Object representing the added values.
+  /// @brief Fused multiply-add. Calculates a + b * s in a single expression, without intermediate points.
+  /// @param[in] a: The point to add to.
+  /// @param[in] b: The point to scale.
+  /// @param[in] s: The scale factor.
+  /// @returns a + b * s
   /// @throws None.
-  /// @version 2011-08-28/GGB - Function created
+  /// @version 2026-10-19/GGB - Function created.
 
   template<typename T>
-  point2D<T> point2D<T>::operator-(const point2D<T> &rhs)
+  constexpr point2D<T> madd(point2D<T> const &a, point2D<T> const &b, T s) noexcept
   {
-    return point2D<T>(*this) -= rhs;
-  }
-
-  // -= operator
-  //
-  // 2011-08-28/GGB - Function created.
-
-  template<typename T>
-  point2D<T> &point2D<T>::operator-=(const point2D<T> &rhs)
-  {
-    if (this == &rhs)
-    {
-      // Self assignment. Makes all values equal to zero.
-
-      xVal = yVal = 0;
-    }
-    else
-    {
-      xVal -= rhs.xVal;
-      yVal -= rhs.yVal;
-    };
-
-    return (*this);
+    return point2D<T>(a.x() + b.x() * s, a.y() + b.y() * s);
   }
 
   /// @brief Stream insertion function for the class.
@@ -239,29 +286,7 @@ namespace MCL
 
 #endif
 
-  /// @brief Friend multiplication function.
-  /// @param[in] rhs: The right hand value.
-  /// @version 2014-03-07/GGB - Function created.
-
-  template<typename T>
-  point2D<T> point2D<T>::operator*= (double const &rhs)
-  {
-    xVal *= rhs;
-    yVal *= rhs;
-
-    return (*this);
-  }
-
-  /// @brief Friend multiplication function.
-  /// @param[in] rhs: The value to multiply by.
-  /// @throws None.
-  /// @version 2014-03-07/GGB - Function created.
-
-  template<typename T>
-  point2D<T> point2D<T>::operator* (double const &rhs) const
-  {
-    return point2D<T>(*this) *= rhs;
-  }
+  static_assert(std::is_trivially_copyable_v<point2D<double>>);
 
 }  // namespace MCL
 
@@ -0,0 +1,362 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								segmentArray.hpp
+// SUBSYSTEM:						2D segment functions
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Functions over arrays of 2D line segments. The segments can be given as a structure of arrays
+//                      (segmentSpan_t: x1[], y1[], x2[], y2[]) or as an array of vector2P_t. The coordinates are read in place,
+//                      no copies are made.
+//                      The loops are branch free so that the compiler can vectorise them (-O3), and large arrays are split over
+//                      threads. The SoA layout vectorises best. (segmentLength is only vectorised with -fno-math-errno, as
+//                      std::sqrt may otherwise set errno.)
+//
+// CLASSES INCLUDED:    segmentSpan_t
+//
+// FUNCTIONS INCLUDED:  segmentAngle(...)
+//                      segmentLength(...)
+//                      segmentDot(...)
+//                      segmentCross(...)
+//                      segmentIntersect(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_SEGMENTARRAY_HPP
+#define MCL_SEGMENTARRAY_HPP
+
+  // Standard C++ library header files
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+  // MCL library header files
+
+#include "trigonometryArray.hpp"
+#include "vector2P.hpp"
+#include "utility/parallel.hpp"
+
+namespace MCL
+{
+  /// @brief A non-owning view of an array of segments stored as a structure of arrays. Segment i runs from (x1[i], y1[i]) to
+  ///        (x2[i], y2[i]).
+
+  template<typename T>
+  class segmentSpan_t
+  {
+  public:
+    std::span<T const> x1;
+    std::span<T const> y1;
+    std::span<T const> x2;
+    std::span<T const> y2;
+
+    /// @brief      Constructs the view.
+    /// @param[in]  X1, Y1: The start points.
+    /// @param[in]  X2, Y2: The end points.
+    /// @throws     std::invalid_argument - The arrays are not the same size.
+    /// @version    2026-10-19/GGB - Function created.
+
+    segmentSpan_t(std::span<T const> X1, std::span<T const> Y1, std::span<T const> X2, std::span<T const> Y2)
+      : x1(X1), y1(Y1), x2(X2), y2(Y2)
+    {
+      if ( (y1.size() != x1.size()) || (x2.size() != x1.size()) || (y2.size() != x1.size()) )
+      {
+        throw std::invalid_argument("MCL::segmentSpan_t - Array sizes differ.");
+      };
+    }
+
+    std::size_t size() const noexcept { return x1.size(); }
+  };
+
+  namespace detail
+  {
+    /// @brief Reads the segments of a segmentSpan_t.
+
+    template<typename T>
+    struct segmentReaderSoA
+    {
+      T const *x1, *y1, *x2, *y2;
+      std::size_t count;
+
+      explicit segmentReaderSoA(segmentSpan_t<T> const &s) noexcept
+        : x1(s.x1.data()), y1(s.y1.data()), x2(s.x2.data()), y2(s.y2.data()), count(s.size()) {}
+
+      std::size_t size() const noexcept { return count; }
+      T px(std::size_t i) const noexcept { return x1[i]; }
+      T py(std::size_t i) const noexcept { return y1[i]; }
+      T dx(std::size_t i) const noexcept { return x2[i] - x1[i]; }
+      T dy(std::size_t i) const noexcept { return y2[i] - y1[i]; }
+    };
+
+    /// @brief Reads the segments of an array of vector2P_t.
+
+    template<typename T>
+    struct segmentReaderAoS
+    {
+      vector2P_t<T> const *v;
+      std::size_t count;
+
+      explicit segmentReaderAoS(std::span<vector2P_t<T> const> s) noexcept : v(s.data()), count(s.size()) {}
+
+      std::size_t size() const noexcept { return count; }
+      T px(std::size_t i) const noexcept { return v[i].P1().x(); }
+      T py(std::size_t i) const noexcept { return v[i].P1().y(); }
+      T dx(std::size_t i) const noexcept { return v[i].P2().x() - v[i].P1().x(); }
+      T dy(std::size_t i) const noexcept { return v[i].P2().y() - v[i].P1().y(); }
+    };
+
+    /// @brief Maps the accepted segment containers to their value type and reader.
+
+    template<typename S>
+    struct segmentTraits;
+
+    template<typename T>
+    struct segmentTraits<segmentSpan_t<T>>
+    {
+      using value_type = T;
+      using reader_type = segmentReaderSoA<T>;
+    };
+
+    template<typename T>
+    struct segmentTraits<std::span<vector2P_t<T> const>>
+    {
+      using value_type = T;
+      using reader_type = segmentReaderAoS<T>;
+    };
+
+    template<typename T>
+    struct segmentTraits<std::vector<vector2P_t<T>>>
+    {
+      using value_type = T;
+      using reader_type = segmentReaderAoS<T>;
+    };
+
+    template<typename S>
+    using segmentValue_t = typename segmentTraits<S>::value_type;
+
+    /// @brief      Checks the array sizes for a segment function.
+    /// @throws     std::invalid_argument
+
+    inline void segmentCheckSize(std::size_t in, std::size_t other, std::size_t out, char const *function)
+    {
+      if (other != in)
+      {
+        throw std::invalid_argument(std::string("MCL::") + function + " - Segment array sizes differ.");
+      }
+      else if (out < in)
+      {
+        throw std::invalid_argument(std::string("MCL::") + function + " - Output array too small.");
+      };
+    }
+
+    /// @brief      Branch free step function.
+    /// @returns    1 if x >= +0, 0 if x <= -0.
+
+    template<typename T>
+    inline T step(T x) noexcept
+    {
+      return T{0.5} + T{0.5} * std::copysign(T{1}, x);
+    }
+
+    /// @brief      Evaluates fn(index) for each segment over blocks, on multiple threads for large arrays.
+
+    template<typename F>
+    void segmentApply(std::size_t count, F fn)
+    {
+      parallelFor(count, [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          fn(index);
+        };
+      }, 10000);
+    }
+  }   // namespace detail
+
+  /// @brief      Calculates the orientation of each segment. (The angle of P2 - P1 from the x axis.)
+  /// @param[in]  segments: The segments. (segmentSpan_t, or an array of vector2P_t)
+  /// @param[out] result: The orientations in [-PI; PI]. Must be at least as large as segments.
+  /// @throws     std::invalid_argument - Output array too small.
+  /// @note       The orientation of a zero length segment is atan2(0, 0) = 0.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename S>
+  void segmentAngle(S const &segments, std::span<detail::segmentValue_t<S>> result)
+  {
+    typename detail::segmentTraits<S>::reader_type reader(segments);
+
+    detail::segmentCheckSize(reader.size(), reader.size(), result.size(), "segmentAngle");
+
+    parallelFor(reader.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+    {
+      for (std::size_t index = indexBegin; index < indexEnd; index++)
+      {
+        result[index] = detail::atan2Kernel(reader.dy(index), reader.dx(index));
+      };
+
+      for (std::size_t index = indexBegin; index < indexEnd; index++)
+      {
+        if (std::isnan(result[index]))
+        {
+          result[index] = std::atan2(reader.dy(index), reader.dx(index));
+        };
+      };
+    }, 10000);
+  }
+
+  /// @brief      Calculates the length of each segment.
+  /// @param[in]  segments: The segments. (segmentSpan_t, or an array of vector2P_t)
+  /// @param[out] result: The lengths. Must be at least as large as segments.
+  /// @throws     std::invalid_argument - Output array too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename S>
+  void segmentLength(S const &segments, std::span<detail::segmentValue_t<S>> result)
+  {
+    typename detail::segmentTraits<S>::reader_type reader(segments);
+
+    detail::segmentCheckSize(reader.size(), reader.size(), result.size(), "segmentLength");
+
+    detail::segmentApply(reader.size(), [&](std::size_t index)
+    {
+      auto dx = reader.dx(index);
+      auto dy = reader.dy(index);
+
+      result[index] = std::sqrt(dx * dx + dy * dy);
+    });
+  }
+
+  /// @brief      Calculates the dot product of the direction vectors (P2 - P1) of corresponding segments.
+  /// @param[in]  a: The first segments. (segmentSpan_t, or an array of vector2P_t)
+  /// @param[in]  b: The second segments. Must be the same size as a.
+  /// @param[out] result: The dot products. Must be at least as large as a.
+  /// @throws     std::invalid_argument - Sizes differ or output array too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename S>
+  void segmentDot(S const &a, S const &b, std::span<detail::segmentValue_t<S>> result)
+  {
+    typename detail::segmentTraits<S>::reader_type ra(a), rb(b);
+
+    detail::segmentCheckSize(ra.size(), rb.size(), result.size(), "segmentDot");
+
+    detail::segmentApply(ra.size(), [&](std::size_t index)
+    {
+      result[index] = ra.dx(index) * rb.dx(index) + ra.dy(index) * rb.dy(index);
+    });
+  }
+
+  /// @brief      Calculates the cross product (z component) of the direction vectors (P2 - P1) of corresponding segments.
+  /// @param[in]  a: The first segments. (segmentSpan_t, or an array of vector2P_t)
+  /// @param[in]  b: The second segments. Must be the same size as a.
+  /// @param[out] result: The cross products. Positive if b turns anticlockwise from a. Must be at least as large as a.
+  /// @throws     std::invalid_argument - Sizes differ or output array too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename S>
+  void segmentCross(S const &a, S const &b, std::span<detail::segmentValue_t<S>> result)
+  {
+    typename detail::segmentTraits<S>::reader_type ra(a), rb(b);
+
+    detail::segmentCheckSize(ra.size(), rb.size(), result.size(), "segmentCross");
+
+    detail::segmentApply(ra.size(), [&](std::size_t index)
+    {
+      result[index] = ra.dx(index) * rb.dy(index) - ra.dy(index) * rb.dx(index);
+    });
+  }
+
+  /// @brief      Tests whether corresponding segments intersect. The end points are included.
+  /// @param[in]  a: The first segments. (segmentSpan_t, or an array of vector2P_t)
+  /// @param[in]  b: The second segments. Must be the same size as a.
+  /// @param[out] result: 1 if the segments intersect, 0 otherwise. Must be at least as large as a.
+  /// @returns    The number of intersecting pairs.
+  /// @throws     std::invalid_argument - Sizes differ or output array too small.
+  /// @note       Parallel (and collinear) segments are reported as not intersecting. The result for NaN coordinates is
+  ///             unspecified.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename S>
+  std::size_t segmentIntersect(S const &a, S const &b, std::span<std::uint8_t> result)
+  {
+    using T = detail::segmentValue_t<S>;
+    typename detail::segmentTraits<S>::reader_type ra(a), rb(b);
+
+    detail::segmentCheckSize(ra.size(), rb.size(), result.size(), "segmentIntersect");
+
+    std::vector<std::size_t> intersectCount(threadCount(ra.size(), 10000), 0);
+
+    parallelFor(ra.size(), intersectCount.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+    {
+      auto const la = ra;                       // Local copies. The uint8_t stores could otherwise alias the readers.
+      auto const lb = rb;
+      std::uint8_t *hits = result.data();
+      std::size_t count = 0;
+
+      for (std::size_t index = indexBegin; index < indexEnd; index++)
+      {
+          // P = Pa + t.Da = Pb + u.Db. Solve for t and u scaled by the determinant, then remove the sign of the determinant
+          // so that the tests are 0 <= t, u <= d without a division. The tests are made with step functions (0.0 or 1.0)
+          // rather than comparisons so that the loop is vectorised. (+ 0 converts -0 to +0.)
+
+        T dax = la.dx(index), day = la.dy(index);
+        T dbx = lb.dx(index), dby = lb.dy(index);
+        T ex = lb.px(index) - la.px(index), ey = lb.py(index) - la.py(index);
+        T d = dax * dby - day * dbx;
+        T sign = std::copysign(T{1}, d);
+        T t = (ex * dby - ey * dbx) * sign + T{0};
+        T u = (ex * day - ey * dax) * sign + T{0};
+
+        d = std::fabs(d);
+
+        hits[index] = static_cast<std::uint8_t>(detail::step(d - std::numeric_limits<T>::denorm_min()) * detail::step(t) *
+                                                detail::step(d - t) * detail::step(u) * detail::step(d - u));
+      };
+
+      for (std::size_t index = indexBegin; index < indexEnd; index++)
+      {
+        count += hits[index];
+      };
+
+      intersectCount[threadNumber] = count;
+    });
+
+    std::size_t returnValue = 0;
+    for (std::size_t count : intersectCount)
+    {
+      returnValue += count;
+    };
+
+    return returnValue;
+  }
+
+} // namespace MCL
+
+#endif // MCL_SEGMENTARRAY_HPP
@@ -0,0 +1,112 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Maths Class Library
+// FILE:								sexagesimal
+// SUBSYSTEM:						Angle class
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman (GGB)
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+//
+// OVERVIEW:						Formatting and parsing of sexagesimal values (DD:MM:SS.ss, HH:MM:SS.ss and packed DDMMSS.ssss).
+//                      The interface follows std::to_chars/std::from_chars. The functions do not allocate and do not throw.
+//                      The value is given in the leading unit (degrees or hours), so the same functions are used for DMS and
+//                      HMS values.
+//                      The value is converted to an integer number of ticks (10^-precision seconds) with a single rounding,
+//                      and the fields are extracted with integer arithmetic. A string that is parsed and formatted again with
+//                      the same number of decimals is reproduced exactly.
+//
+// CLASSES INCLUDED:		None
+//
+// FUNCTIONS INCLUDED:  sexagesimalToChars(...)
+//                      sexagesimalFromChars(...)
+//                      packSexagesimal(...)
+//                      unpackSexagesimal(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_SEXAGESIMAL_H
+#define MCL_SEXAGESIMAL_H
+
+  // Standard C++ libraries
+
+#include <charconv>
+#include <cmath>
+#include <span>
+
+  // MCL Library
+
+#include "config.h"
+
+namespace MCL
+{
+  enum sexagesimalFormat_e
+  {
+    SF_SEPARATED,     ///< format = [-]DD:MM:SS.ss (or HH:MM:SS.ss)
+    SF_PACKED,        ///< format = [-]DDMMSS.ssss (or HHMMSS.ssss)
+  };
+
+  int constexpr SEXAGESIMAL_MAXPRECISION = 9;     ///< Maximum number of decimals of the seconds.
+
+  std::to_chars_result sexagesimalToChars(char *, char *, FP_t, sexagesimalFormat_e = SF_SEPARATED, int = 2) noexcept;
+  std::to_chars_result sexagesimalToChars(char *, char *, std::span<FP_t const>, sexagesimalFormat_e = SF_SEPARATED, int = 2,
+                                          char = '\n') noexcept;
+
+  std::from_chars_result sexagesimalFromChars(char const *, char const *, FP_t &, sexagesimalFormat_e = SF_SEPARATED) noexcept;
+  std::from_chars_result sexagesimalFromChars(char const *, char const *, std::span<FP_t>,
+                                              sexagesimalFormat_e = SF_SEPARATED, char = '\n') noexcept;
+
+  /// @brief      Converts a packed sexagesimal number (DDMMSS.ssss or HHMMSS.ssss) to the leading unit. (Degrees or hours.)
+  /// @param[in]  value: The packed value.
+  /// @returns    The value in the leading unit.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline FP_t unpackSexagesimal(FP_t value) noexcept
+  {
+    FP_t magnitude = std::fabs(value);
+    FP_t units = std::floor(magnitude / 10000);
+    FP_t minutes = std::floor((magnitude - units * 10000) / 100);
+    FP_t seconds = magnitude - units * 10000 - minutes * 100;
+
+    return std::copysign(units + minutes / 60 + seconds / 3600, value);
+  }
+
+  /// @brief      Converts a value in the leading unit (degrees or hours) to a packed sexagesimal number.
+  /// @param[in]  value: The value to pack.
+  /// @returns    The packed value. (DDMMSS.ssss or HHMMSS.ssss)
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline FP_t packSexagesimal(FP_t value) noexcept
+  {
+    FP_t magnitude = std::fabs(value);
+    FP_t units = std::floor(magnitude);
+    FP_t minutes = (magnitude - units) * 60;
+    FP_t wholeMinutes = std::floor(minutes);
+    FP_t seconds = (minutes - wholeMinutes) * 60;
+
+    return std::copysign(units * 10000 + wholeMinutes * 100 + seconds, value);
+  }
+
+}   // namespace MCL
+
+#endif // MCL_SEXAGESIMAL_H
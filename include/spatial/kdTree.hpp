@@ -0,0 +1,479 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								kdTree
+// SUBSYSTEM:						Spatial index
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A k-d tree over point2D or TVector3D points.
+//                      The tree is implicit: the nodes are held in a single flat array, and the node for the range [b; e) is
+//                      at the median position (b + e) / 2, with the left subtree in [b; mid) and the right subtree in
+//                      [mid + 1; e). No child pointers are stored. Each node is split on the axis of largest spread.
+//                      The tree is built with nth_element. The top levels of the build are split over threads, which run in
+//                      the execution context of the calling thread.
+//                      The queries return the indices of the points in the array that the tree was built from.
+//
+// CLASSES INCLUDED:    pointTraits
+//                      kdTree_t
+//
+// HISTORY:             2026-10-19 GGB - Build threads run in the execution context of the caller.
+//                      2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_SPATIAL_KDTREE_HPP
+#define MCL_SPATIAL_KDTREE_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+  // MCL library header files.
+
+#include "../config.h"
+#include "../point2D.hpp"
+#include "../TVector3D.hpp"
+#include "../utility/executionContext.h"
+#include "../utility/parallel.hpp"
+
+namespace MCL
+{
+  /// @brief Describes the coordinates of a point type for the spatial index.
+
+  template<typename P>
+  struct pointTraits;
+
+  template<typename T>
+  struct pointTraits<point2D<T>>
+  {
+    using value_type = T;
+    static constexpr std::size_t DIMENSIONS = 2;
+
+    static constexpr T coordinate(point2D<T> const &point, std::size_t axis) noexcept
+    {
+      return (axis == 0) ? point.x() : point.y();
+    }
+  };
+
+  template<typename T>
+  struct pointTraits<TVector3D<T>>
+  {
+    using value_type = T;
+    static constexpr std::size_t DIMENSIONS = 3;
+
+    static constexpr T coordinate(TVector3D<T> const &point, std::size_t axis) noexcept
+    {
+      return point[static_cast<int>(axis)];
+    }
+  };
+
+  template<typename P>
+  class kdTree_t
+  {
+  public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);     ///< Marks a missing neighbour.
+
+  private:
+    using traits = pointTraits<P>;
+    static constexpr std::size_t DIMENSIONS = traits::DIMENSIONS;
+
+    struct node_t
+    {
+      P point;
+      std::size_t index;        ///< Index of the point in the source array.
+      std::uint8_t axis;        ///< Split axis.
+    };
+
+    using candidate_t = std::pair<FP_t, std::size_t>;     ///< (distance^2, node)
+
+    std::vector<node_t> nodes_;
+
+    static FP_t coordinate(P const &point, std::size_t axis) noexcept
+    {
+      return static_cast<FP_t>(traits::coordinate(point, axis));
+    }
+
+    static FP_t distance2(P const &lhs, P const &rhs) noexcept
+    {
+      FP_t returnValue = 0;
+
+      for (std::size_t axis = 0; axis < DIMENSIONS; axis++)
+      {
+        FP_t d = coordinate(lhs, axis) - coordinate(rhs, axis);
+        returnValue += d * d;
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Builds the subtree for the range [indexBegin; indexEnd).
+    /// @param[in]  indexBegin: The first node.
+    /// @param[in]  indexEnd: One past the last node.
+    /// @param[in]  threadDepth: The number of further levels to split over threads.
+    /// @param[in]  threadNumber: The number of the thread. The threads started below are numbered threadNumber + 1 to
+    ///             threadNumber + 2^threadDepth - 1. (Used to pin the threads.)
+    /// @throws     std::system_error - Unable to start a thread.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void build(std::size_t indexBegin, std::size_t indexEnd, std::size_t threadDepth, std::size_t threadNumber)
+    {
+      if (indexEnd - indexBegin < 2)
+      {
+        return;
+      };
+
+      FP_t lower[DIMENSIONS], upper[DIMENSIONS];
+
+      for (std::size_t axis = 0; axis < DIMENSIONS; axis++)
+      {
+        lower[axis] = upper[axis] = coordinate(nodes_[indexBegin].point, axis);
+      };
+
+      for (std::size_t index = indexBegin + 1; index < indexEnd; index++)
+      {
+        for (std::size_t axis = 0; axis < DIMENSIONS; axis++)
+        {
+          FP_t c = coordinate(nodes_[index].point, axis);
+          lower[axis] = std::min(lower[axis], c);
+          upper[axis] = std::max(upper[axis], c);
+        };
+      };
+
+      std::uint8_t splitAxis = 0;
+      for (std::size_t axis = 1; axis < DIMENSIONS; axis++)
+      {
+        if ((upper[axis] - lower[axis]) > (upper[splitAxis] - lower[splitAxis]))
+        {
+          splitAxis = static_cast<std::uint8_t>(axis);
+        };
+      };
+
+      std::size_t indexMid = indexBegin + (indexEnd - indexBegin) / 2;
+
+      std::nth_element(nodes_.begin() + indexBegin, nodes_.begin() + indexMid, nodes_.begin() + indexEnd,
+                       [splitAxis](node_t const &lhs, node_t const &rhs)
+                       {
+                         return traits::coordinate(lhs.point, splitAxis) < traits::coordinate(rhs.point, splitAxis);
+                       });
+      nodes_[indexMid].axis = splitAxis;
+
+      if (threadDepth > 0)
+      {
+        executionContext_t const *context = executionContext_t::current();
+        std::size_t leftNumber = threadNumber + (std::size_t{1} << (threadDepth - 1));
+
+        std::jthread left([this, context, indexBegin, indexMid, threadDepth, leftNumber]()
+        {
+          executionContext_t::scope_t scope(context);
+
+          if (context)
+          {
+            context->enter(leftNumber);
+          };
+          build(indexBegin, indexMid, threadDepth - 1, leftNumber);
+        });
+        build(indexMid + 1, indexEnd, threadDepth - 1, threadNumber);
+      }
+      else
+      {
+        build(indexBegin, indexMid, 0, threadNumber);
+        build(indexMid + 1, indexEnd, 0, threadNumber);
+      };
+    }
+
+    /// @brief      Searches the subtree [indexBegin; indexEnd) for the k nearest neighbours.
+    /// @param[in]  query: The query point.
+    /// @param[in]  k: The number of neighbours.
+    /// @param[in]  indexBegin: The first node.
+    /// @param[in]  indexEnd: One past the last node.
+    /// @param[inout] heap: Max-heap of the best candidates found.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    void searchNearest(P const &query, std::size_t k, std::size_t indexBegin, std::size_t indexEnd,
+                       std::vector<candidate_t> &heap) const
+    {
+      if (indexBegin >= indexEnd)
+      {
+        return;
+      };
+
+      std::size_t indexMid = indexBegin + (indexEnd - indexBegin) / 2;
+      node_t const &node = nodes_[indexMid];
+      FP_t d2 = distance2(query, node.point);
+
+      if (heap.size() < k)
+      {
+        heap.emplace_back(d2, indexMid);
+        std::push_heap(heap.begin(), heap.end());
+      }
+      else if (d2 < heap.front().first)
+      {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = candidate_t(d2, indexMid);
+        std::push_heap(heap.begin(), heap.end());
+      };
+
+      FP_t diff = coordinate(query, node.axis) - coordinate(node.point, node.axis);
+
+      if (diff < 0)
+      {
+        searchNearest(query, k, indexBegin, indexMid, heap);
+        if ( (heap.size() < k) || (diff * diff < heap.front().first) )
+        {
+          searchNearest(query, k, indexMid + 1, indexEnd, heap);
+        };
+      }
+      else
+      {
+        searchNearest(query, k, indexMid + 1, indexEnd, heap);
+        if ( (heap.size() < k) || (diff * diff < heap.front().first) )
+        {
+          searchNearest(query, k, indexBegin, indexMid, heap);
+        };
+      };
+    }
+
+    /// @brief      Searches the subtree [indexBegin; indexEnd) for the points within a radius.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    void searchRadius(P const &query, FP_t radius2, std::size_t indexBegin, std::size_t indexEnd,
+                      std::vector<std::size_t> &result) const
+    {
+      if (indexBegin >= indexEnd)
+      {
+        return;
+      };
+
+      std::size_t indexMid = indexBegin + (indexEnd - indexBegin) / 2;
+      node_t const &node = nodes_[indexMid];
+
+      if (distance2(query, node.point) <= radius2)
+      {
+        result.push_back(node.index);
+      };
+
+      FP_t diff = coordinate(query, node.axis) - coordinate(node.point, node.axis);
+
+      if ( (diff <= 0) || (diff * diff <= radius2) )
+      {
+        searchRadius(query, radius2, indexBegin, indexMid, result);
+      };
+      if ( (diff >= 0) || (diff * diff <= radius2) )
+      {
+        searchRadius(query, radius2, indexMid + 1, indexEnd, result);
+      };
+    }
+
+    /// @brief      Searches the subtree [indexBegin; indexEnd) for the points within a box.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    void searchBox(P const &lower, P const &upper, std::size_t indexBegin, std::size_t indexEnd,
+                   std::vector<std::size_t> &result) const
+    {
+      if (indexBegin >= indexEnd)
+      {
+        return;
+      };
+
+      std::size_t indexMid = indexBegin + (indexEnd - indexBegin) / 2;
+      node_t const &node = nodes_[indexMid];
+      bool inside = true;
+
+      for (std::size_t axis = 0; axis < DIMENSIONS; axis++)
+      {
+        FP_t c = coordinate(node.point, axis);
+        inside = inside && (c >= coordinate(lower, axis)) && (c <= coordinate(upper, axis));
+      };
+
+      if (inside)
+      {
+        result.push_back(node.index);
+      };
+
+      FP_t c = coordinate(node.point, node.axis);
+
+      if (c >= coordinate(lower, node.axis))
+      {
+        searchBox(lower, upper, indexBegin, indexMid, result);
+      };
+      if (c <= coordinate(upper, node.axis))
+      {
+        searchBox(lower, upper, indexMid + 1, indexEnd, result);
+      };
+    }
+
+  protected:
+  public:
+    kdTree_t() = default;
+
+    /// @brief      Builds the tree over an array of points.
+    /// @param[in]  points: The points. The queries return indices into this array.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    explicit kdTree_t(std::span<P const> points)
+    {
+      nodes_.reserve(points.size());
+
+      for (std::size_t index = 0; index < points.size(); index++)
+      {
+        nodes_.push_back(node_t{ points[index], index, 0 });
+      };
+
+      std::size_t threadDepth = 0;
+      for (std::size_t threads = threadCount(points.size(), 10000); threads > 1; threads /= 2)
+      {
+        threadDepth++;
+      };
+
+      build(0, nodes_.size(), threadDepth, 0);
+    }
+
+    std::size_t size() const noexcept { return nodes_.size(); }
+    bool empty() const noexcept { return nodes_.empty(); }
+
+    /// @brief      Finds the k nearest points to a query point.
+    /// @param[in]  query: The query point.
+    /// @param[in]  k: The number of neighbours to find.
+    /// @returns    The indices of the nearest points, nearest first. Fewer than k if the tree holds fewer than k points.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::vector<std::size_t> nearest(P const &query, std::size_t k) const
+    {
+      std::vector<candidate_t> heap;
+      std::vector<std::size_t> returnValue;
+
+      heap.reserve(std::min(k, nodes_.size()));
+      searchNearest(query, k, 0, nodes_.size(), heap);
+      std::sort_heap(heap.begin(), heap.end());
+
+      returnValue.reserve(heap.size());
+      for (candidate_t const &candidate : heap)
+      {
+        returnValue.push_back(nodes_[candidate.second].index);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Finds the k nearest points to each of an array of query points. The queries are split over threads.
+    /// @param[in]  queries: The query points.
+    /// @param[in]  k: The number of neighbours to find for each query.
+    /// @returns    queries.size() rows of k indices, nearest first. Missing neighbours are set to npos.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::vector<std::size_t> nearest(std::span<P const> queries, std::size_t k) const
+    {
+      std::vector<std::size_t> returnValue(queries.size() * k, npos);
+
+      parallelFor(queries.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        std::vector<candidate_t> heap;
+
+        heap.reserve(std::min(k, nodes_.size()));
+
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          heap.clear();
+          searchNearest(queries[index], k, 0, nodes_.size(), heap);
+          std::sort_heap(heap.begin(), heap.end());
+
+          for (std::size_t neighbour = 0; neighbour < heap.size(); neighbour++)
+          {
+            returnValue[index * k + neighbour] = nodes_[heap[neighbour].second].index;
+          };
+        };
+      }, 256);
+
+      return returnValue;
+    }
+
+    /// @brief      Finds the points within a distance of a query point.
+    /// @param[in]  query: The query point.
+    /// @param[in]  radius: The search radius. Points at the radius are included.
+    /// @returns    The indices of the points. (In no particular order.)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::vector<std::size_t> radius(P const &query, FP_t radius) const
+    {
+      std::vector<std::size_t> returnValue;
+
+      searchRadius(query, radius * radius, 0, nodes_.size(), returnValue);
+
+      return returnValue;
+    }
+
+    /// @brief      Finds the points within a distance of each of an array of query points. The queries are split over
+    ///             threads.
+    /// @param[in]  queries: The query points.
+    /// @param[in]  radius: The search radius. Points at the radius are included.
+    /// @returns    The indices of the points for each query. (In no particular order.)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::vector<std::vector<std::size_t>> radius(std::span<P const> queries, FP_t radius) const
+    {
+      std::vector<std::vector<std::size_t>> returnValue(queries.size());
+
+      parallelFor(queries.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          searchRadius(queries[index], radius * radius, 0, nodes_.size(), returnValue[index]);
+        };
+      }, 256);
+
+      return returnValue;
+    }
+
+    /// @brief      Finds the points within an axis aligned box.
+    /// @param[in]  lower: The lower corner of the box.
+    /// @param[in]  upper: The upper corner of the box.
+    /// @returns    The indices of the points. Points on the faces of the box are included. (In no particular order.)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::vector<std::size_t> box(P const &lower, P const &upper) const
+    {
+      std::vector<std::size_t> returnValue;
+
+      searchBox(lower, upper, 0, nodes_.size(), returnValue);
+
+      return returnValue;
+    }
+  };
+
+} // namespace MCL
+
+#endif // MCL_SPATIAL_KDTREE_HPP
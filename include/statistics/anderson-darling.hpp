@@ -3,22 +3,24 @@
 
   // Standard C++ library header files
 
+#include <algorithm>
 #include <cmath>
-#include <functional>
 #include <map>
+#include <span>
 #include <stdexcept>
 #include <valarray>
 
-  // Miscellaneous library header files
-
-#include "boost/math/distributions.hpp"
-
   // MCL header files
 
 #include "../config.h"
 #include "../functions.hpp"
 #include "../definitions.h"
+#include "../utility/async.hpp"
+#include "../utility/cancellation.h"
+#include "../utility/instrument.h"
 #include "../utility/sort.hpp"
+#include "../utility/workspace.hpp"
+#include "distributionFunctions/cdf.hpp"
 
 namespace MCL
 {
@@ -127,6 +129,8 @@ namespace MCL
   /* PDF Parameters
    * Normal: [0] = Mean, [1] = stDev
    * Weibull: [0] = alpha, [1] = beta
+   * Gamma: [0] = shape, [1] = scale
+   * (See statistics/distributionFunctions/cdf.hpp)
    */
 
 
@@ -134,112 +138,37 @@ namespace MCL
   ///        PDF's with the results being returned in the passed vector.
   /// @param[in] X: The data to test
   /// @param[in/out] results: A vector of the distributions to test and the results obtained.
+  /// @param[in] workspace: Scratch memory for the sorted data and the CDF values.
+  /// @throws MCL::operation_cancelled, MCL::deadline_exceeded - If a cancellation is installed for the calling thread.
+  /// @throws std::runtime_error - Too few parameters, or an unsupported PDF.
+  /// @note The cancellation is checked after the sort and before each distribution is tested.
+  /// @note The CDF values are calculated with distributionCDF(...).
 
   template<typename T>
-  void anderson_darling_1S(std::valarray<T> const &X, std::vector<goodnessOfFit_t> &results)
+  void anderson_darling_1S(std::valarray<T> const &X, std::vector<goodnessOfFit_t> &results,
+                           workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("anderson_darling_1S", X.size(), X.size() * sizeof(T));
+
     std::size_t indx;
     std::size_t N = X.size();
 
-    std::valarray<T> X_(X);
-    MCL::sort(std::begin(X_), std::end(X_));     // Sort the array
+    workspace_t::scope_t scope(workspace);
+    std::span<T> X_ = workspace.allocate<T>(N);
+    std::span<T> Fx = workspace.allocate<T>(N);
+
+    std::copy(std::begin(X), std::end(X), X_.begin());
+    MCL::sort(X_.begin(), X_.end());     // Sort the array
 
       // Loop over each PDF requested to be tested.
 
     for (auto &GOF: results)
     {
-      std::function<FP_t(FP_t)> fn_cdf;
-
-      switch (GOF.PDF)
-      {
-        case PDF_NORMAL:
-        {
-          if (GOF.parameters.size() < 2)
-          {
-            throw std::runtime_error("Too few parameters for PDF:Normal. Two (2) required.");
-          }
-          else
-          {
-            fn_cdf = [GOF](FP_t p)
-            {
-              boost::math::normal_distribution normal(GOF.parameters[0], GOF.parameters[1]);
-              return boost::math::cdf(normal, p);
-            };
-          }
-          break;
-        }
-        case PDF_EXPONENTIAL:
-        {
-          if (GOF.parameters.size() < 1)
-          {
-            throw std::runtime_error("Too few parameters for PDF:Exponential. One (1) required.");
-          }
-          else
-          {
-            fn_cdf = [GOF](FP_t p)
-            {
-              boost::math::exponential_distribution exponential(GOF.parameters[0]);
-              return boost::math::cdf(exponential, p);
-            };
-          }
-          break;
-        }
-        case PDF_WEIBULL:
-        {
-          if (GOF.parameters.size() < 2)
-          {
-            throw std::runtime_error("Too few parameters for PDF:Weibull. Two (2) required.");
-          }
-          else
-          {
-            fn_cdf = [GOF](FP_t p)
-            {
-              boost::math::weibull_distribution weibull(GOF.parameters[0], GOF.parameters[1]);
-              return boost::math::cdf(weibull, p);
-            };
-          }
-          break;
-        }
-        case PDF_GAMMA:
-        {
-          if (GOF.parameters.size() >= 2)
-          {
-            fn_cdf = [GOF](FP_t p)
-            {
-              boost::math::weibull_distribution gamma(GOF.parameters[0], GOF.parameters[1]);
-              return boost::math::cdf(gamma, p);
-            };
-          }
-          else
-          {
-            throw std::runtime_error("Too few parameters for PDF:Gamma. Two (2) required.");
-          }
-          break;
-        }
-        default:
-        {
-          throw std::runtime_error("Invalid PDF function");
-          break;
-        };
-      }
-
-      std::valarray<T> Fx(X_.size());
+      cancellationPoint();
 
-        /* Calculate the values.
-         * Fx = F(x) where F(x) = CDF to be tested. (PDF_NORMAL etc)
-         */
-
-      for (indx = 0; indx < N; indx++)
-      {
-        Fx[indx] = fn_cdf(X_[indx]);
-      }
+        // Fx = F(x) where F(x) = CDF to be tested. (PDF_NORMAL etc)
 
-      //std::cout << "Fx {" << Fx[0];
-//      for (indx = 1; indx < N; indx++)
-//      {
-//        std::cout << ", " << Fx[indx];
-//      }
-      //std::cout << "}" << std::endl;
+      distributionCDF(GOF.PDF, std::span<FP_t const>(GOF.parameters), std::span<T const>(X_), Fx);
 
         // Perform the analysis.
 
@@ -498,6 +427,23 @@ namespace MCL
 
   }
 
+  /// @brief Performs an Anderson-Darling goodness of fit test on an executor.
+  /// @param[in] options: The stop token, deadline and executor for the call.
+  /// @param[in] X: The data to test
+  /// @param[in] results: A vector of the distributions to test.
+  /// @returns A future for the results.
+  /// @throws std::bad_alloc
+
+  template<typename T>
+  std::future<std::vector<goodnessOfFit_t>> anderson_darling_1S(asyncOptions_t const &options, std::valarray<T> X,
+                                                                std::vector<goodnessOfFit_t> results)
+  {
+    return MCL::async(options, [X = std::move(X), results = std::move(results)]() mutable
+    {
+      anderson_darling_1S(X, results);
+      return std::move(results);
+    });
+  }
 
 }
 
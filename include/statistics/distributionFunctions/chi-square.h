@@ -1,4 +1,328 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								statistics/distributionFunctions/chi-square.h
+// SUBSYSTEM:						Statistics Functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            The chi-square distribution and the Pearson and G goodness of fit tests of binned data.
+//                      The distribution functions are evaluated with the regularised incomplete gamma functions:
+//                        CDF(x; k) = P(k / 2, x / 2),  SF(x; k) = Q(k / 2, x / 2)
+//                      The span versions are multi-threaded. (See functions/gamma.hpp.)
+//                      The tests compare observed counts (for example the counts of a histogram_t) with expected counts or
+//                      probabilities. The expected values are scaled so that their total equals the observed total. The degrees
+//                      of freedom are the number of bins less one, less the number of parameters of the distribution that were
+//                      estimated from the data.
+//
+// CLASSES INCLUDED:    chiSquareTest_t
+//
+// FUNCTIONS INCLUDED:  chiSquarePDF(...)
+//                      chiSquareCDF(...)
+//                      chiSquareSF(...)
+//                      chiSquareQuantile(...)
+//                      pearsonTest(...)
+//                      gTest(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
 #ifndef CHISQUARE_H
 #define CHISQUARE_H
 
+  // Standard C++ library
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+  // MCL Library
+
+#include "../../config.h"
+#include "../../functions/gamma.hpp"
+#include "../../utility/parallel.hpp"
+
+namespace MCL
+{
+  struct chiSquareTest_t
+  {
+    FP_t statistic;                 ///< The test statistic.
+    FP_t degreesOfFreedom;
+    FP_t pValue;                    ///< The probability of a statistic at least as large if the null hypothesis is true.
+  };
+
+  /// @brief      Returns the probability density of the chi-square distribution.
+  /// @param[in]  x: The value.
+  /// @param[in]  k: The degrees of freedom. (k > 0)
+  /// @returns    The density. NaN if k is not positive.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline FP_t chiSquarePDF(FP_t x, FP_t k) noexcept
+  {
+    if ( !(k > 0) || std::isnan(x) )
+    {
+      return std::numeric_limits<FP_t>::quiet_NaN();
+    }
+    else if (x < 0)
+    {
+      return 0;
+    }
+    else if (x == 0)
+    {
+      return (k < 2) ? std::numeric_limits<FP_t>::infinity() : (k == 2) ? 0.5 : 0;
+    }
+    else
+    {
+      FP_t a = k / 2;
+
+      return std::exp((a - 1) * std::log(x) - x / 2 - a * std::log(FP_t{2}) - logGamma(a));
+    };
+  }
+
+  /// @brief      Returns the cumulative distribution function of the chi-square distribution.
+  /// @param[in]  x: The value.
+  /// @param[in]  k: The degrees of freedom. (k > 0)
+  /// @returns    P(X <= x). NaN if k is not positive.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline FP_t chiSquareCDF(FP_t x, FP_t k) noexcept
+  {
+    return gammaP(k / 2, x / 2);
+  }
+
+  /// @brief      Returns the survival function (1 - CDF) of the chi-square distribution. This is the p-value of a
+  ///             chi-square statistic.
+  /// @param[in]  x: The value.
+  /// @param[in]  k: The degrees of freedom. (k > 0)
+  /// @returns    P(X > x). NaN if k is not positive.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline FP_t chiSquareSF(FP_t x, FP_t k) noexcept
+  {
+    return gammaQ(k / 2, x / 2);
+  }
+
+  /// @brief      Returns the quantile (inverse CDF) of the chi-square distribution.
+  /// @param[in]  p: The probability. [0; 1]
+  /// @param[in]  k: The degrees of freedom. (k > 0)
+  /// @returns    x such that P(X <= x) = p. NaN if p or k is not valid.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline FP_t chiSquareQuantile(FP_t p, FP_t k) noexcept
+  {
+    return 2 * gammaPInverse(k / 2, p);
+  }
+
+  namespace detail
+  {
+    /// @brief      Evaluates the chi-square CDF or SF over a span. (Multi-threaded.)
+    /// @param[in]  x: The values.
+    /// @param[in]  k: The degrees of freedom of each value, or a single value for all the values.
+    /// @param[out] result: The CDF or SF values.
+    /// @param[in]  upper: true for the SF, false for the CDF.
+    /// @throws     std::invalid_argument - The spans are different sizes.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    void chiSquareDistribution(std::span<T const> x, std::span<T const> k, std::span<T> result, bool upper)
+    {
+      if ( ((k.size() != 1) && (k.size() != x.size())) || (result.size() != x.size()) )
+      {
+        throw std::invalid_argument("MCL::chiSquareCDF/chiSquareSF - The spans must be the same size.");
+      };
+
+      parallelFor(x.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        if (k.size() == 1)
+        {
+          gammaShape_t const shape = gammaShape(static_cast<double>(k[0]) / 2);
+
+          for (std::size_t index = indexBegin; index < indexEnd; index++)
+          {
+            result[index] = static_cast<T>(incompleteGamma(shape, static_cast<double>(x[index]) / 2, upper));
+          };
+        }
+        else
+        {
+          for (std::size_t index = indexBegin; index < indexEnd; index++)
+          {
+            result[index] = static_cast<T>(incompleteGamma(gammaShape(static_cast<double>(k[index]) / 2),
+                                                           static_cast<double>(x[index]) / 2, upper));
+          };
+        };
+      }, GAMMA_GRAIN);
+    }
+
+    /// @brief      Checks the observed and expected values of a test and returns the factor that scales the expected
+    ///             values to the observed total.
+    /// @param[in]  observed: The observed counts.
+    /// @param[in]  expected: The expected counts or probabilities.
+    /// @param[in]  fittedParameters: The number of parameters estimated from the data.
+    /// @param[in]  function: The name of the calling function. (For the exception messages.)
+    /// @returns    The scale factor.
+    /// @throws     std::invalid_argument - The arguments are not valid.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T, typename U>
+    FP_t chiSquareScale(std::span<T const> observed, std::span<U const> expected, std::size_t fittedParameters,
+                        char const *function)
+    {
+      if (observed.size() != expected.size())
+      {
+        throw std::invalid_argument(std::string(function) + " - Observed and expected must be the same size.");
+      };
+      if (observed.size() < fittedParameters + 2)
+      {
+        throw std::invalid_argument(std::string(function) + " - Too few bins for the degrees of freedom.");
+      };
+
+      FP_t observedTotal = 0;
+      FP_t expectedTotal = 0;
+
+      for (std::size_t index = 0; index < observed.size(); index++)
+      {
+        if ( !(observed[index] >= 0) || !(expected[index] >= 0) )
+        {
+          throw std::invalid_argument(std::string(function) + " - Counts must not be negative.");
+        };
+        observedTotal += static_cast<FP_t>(observed[index]);
+        expectedTotal += static_cast<FP_t>(expected[index]);
+      };
+
+      if (!(expectedTotal > 0) || std::isinf(expectedTotal))
+      {
+        throw std::invalid_argument(std::string(function) + " - The expected total must be positive.");
+      };
+
+      return observedTotal / expectedTotal;
+    }
+  }
+
+  /// @brief      Evaluates the chi-square CDF for an array of values with the same degrees of freedom.
+  /// @param[in]  x: The values.
+  /// @param[in]  k: The degrees of freedom. (k > 0)
+  /// @param[out] result: The CDF values. (The same size as x.)
+  /// @throws     std::invalid_argument - result is a different size to x.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  void chiSquareCDF(std::span<T const> x, T k, std::span<T> result)
+  {
+    detail::chiSquareDistribution(x, std::span<T const>(&k, 1), result, false);
+  }
+
+  /// @brief      Evaluates the chi-square survival function for arrays of statistics and degrees of freedom. (For
+  ///             example the p-values of many tests.)
+  /// @param[in]  x: The values.
+  /// @param[in]  k: The degrees of freedom of each value. (k > 0)
+  /// @param[out] result: The survival function values. (The same size as x.)
+  /// @throws     std::invalid_argument - The spans are different sizes.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  void chiSquareSF(std::span<T const> x, std::span<T const> k, std::span<T> result)
+  {
+    detail::chiSquareDistribution(x, k, result, true);
+  }
+
+  /// @brief      Performs Pearson's chi-square goodness of fit test.
+  ///               X^2 = sum((O - E)^2 / E)
+  /// @param[in]  observed: The observed counts.
+  /// @param[in]  expected: The expected counts or probabilities. (Scaled to the observed total.)
+  /// @param[in]  fittedParameters: The number of parameters of the distribution estimated from the data.
+  /// @returns    The statistic, degrees of freedom and p-value. A bin with no expected count and a non-zero observed
+  ///             count gives an infinite statistic and a p-value of zero.
+  /// @throws     std::invalid_argument - The spans are different sizes, there are too few bins, a count is negative or
+  ///                                     the expected total is not positive.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T, typename U>
+  chiSquareTest_t pearsonTest(std::span<T const> observed, std::span<U const> expected, std::size_t fittedParameters = 0)
+  {
+    FP_t scale = detail::chiSquareScale(observed, expected, fittedParameters, "MCL::pearsonTest");
+    FP_t statistic = 0;
+
+    for (std::size_t index = 0; index < observed.size(); index++)
+    {
+      FP_t O = static_cast<FP_t>(observed[index]);
+      FP_t E = static_cast<FP_t>(expected[index]) * scale;
+
+      if (E > 0)
+      {
+        statistic += (O - E) * (O - E) / E;
+      }
+      else if (O > 0)
+      {
+        statistic = std::numeric_limits<FP_t>::infinity();
+      };
+    };
+
+    FP_t dof = static_cast<FP_t>(observed.size() - 1 - fittedParameters);
+
+    return { statistic, dof, chiSquareSF(statistic, dof) };
+  }
+
+  /// @brief      Performs the G-test (likelihood ratio) of goodness of fit.
+  ///               G = 2 sum(O ln(O / E))
+  /// @param[in]  observed: The observed counts.
+  /// @param[in]  expected: The expected counts or probabilities. (Scaled to the observed total.)
+  /// @param[in]  fittedParameters: The number of parameters of the distribution estimated from the data.
+  /// @returns    The statistic, degrees of freedom and p-value. A bin with no expected count and a non-zero observed
+  ///             count gives an infinite statistic and a p-value of zero.
+  /// @throws     std::invalid_argument - The spans are different sizes, there are too few bins, a count is negative or
+  ///                                     the expected total is not positive.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T, typename U>
+  chiSquareTest_t gTest(std::span<T const> observed, std::span<U const> expected, std::size_t fittedParameters = 0)
+  {
+    FP_t scale = detail::chiSquareScale(observed, expected, fittedParameters, "MCL::gTest");
+    FP_t statistic = 0;
+
+    for (std::size_t index = 0; index < observed.size(); index++)
+    {
+      FP_t O = static_cast<FP_t>(observed[index]);
+      FP_t E = static_cast<FP_t>(expected[index]) * scale;
+
+      if (O > 0)
+      {
+        statistic += (E > 0) ? O * std::log(O / E) : std::numeric_limits<FP_t>::infinity();
+      };
+    };
+
+    statistic *= 2;
+
+    FP_t dof = static_cast<FP_t>(observed.size() - 1 - fittedParameters);
+
+    return { statistic, dof, chiSquareSF(statistic, dof) };
+  }
+}
+
 #endif // CHISQUARE_H
@@ -24,7 +24,8 @@
 //                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
 //                      <http://www.gnu.org/licenses/>.
 //
-// HISTORY:             2022-12-21 GGB - File created.
+// HISTORY:             2026-10-19 GGB - weibull_regression uses a pipeline for the regression.
+//                      2022-12-21 GGB - File created.
 //
 //*********************************************************************************************************************************
 
@@ -33,42 +34,52 @@
 
   // Standard C++ library
 
+#include <algorithm>
 #include <cmath>
+#include <span>
 #include <utility>
 #include <valarray>
 
   // MCL Library
 
-#include "../../functions/linearRegression.hpp"
+#include "../pipeline.hpp"
 #include "../../utility/sort.hpp"
+#include "../../utility/workspace.hpp"
 
 namespace MCL
 {
+  /// @brief      Estimates the shape and scale of a Weibull distribution by regression of the median ranks.
+  /// @param[in]  N: The data.
+  /// @param[in]  workspace: Scratch memory for the sorted copy of the data.
+  /// @returns    The scale (first) and shape (second).
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - The logarithms and median ranks are calculated in the regression pass. (No X and Y
+  ///                              arrays.)
+  /// @version    2026-10-19/GGB - Regression arrays allocated from a workspace.
+  /// @version    2022-12-21/GGB - Function created.
+
   template<typename T>
-  std::pair<T, T> weibull_regression(std::valarray<T> const &N)
+  std::pair<T, T> weibull_regression(std::valarray<T> const &N, workspace_t &workspace = workspace_t::local())
   {
-    std::size_t indx;
-
-    std::valarray<T> Ns(N);
-
-    MCL::sort(std::begin(Ns), std::end(Ns));     // Sort the array
+    workspace_t::scope_t scope(workspace);
+    std::span<T> X = workspace.allocate<T>(N.size());
 
-    std::valarray<T> X(std::log(Ns));
-    std::valarray<T> Y(X.size());
+    std::copy(std::begin(N), std::end(N), X.begin());
+    MCL::sort(X.begin(), X.end());     // Sort the array
 
     T n = 1 / static_cast<T>(N.size());
 
-    for (indx = 0; indx < X.size(); indx++)
-    {
-     Y[indx] = std::log(-std::log(1 - ((static_cast<T>(indx) + 0.5) * n)));
-    }
+      // X = ln(x), Y = ln(-ln(1 - median rank))
 
-    std::pair<T, T> r = linearRegression(X, Y);
+    std::pair<FP_t, FP_t> r = pipeline(std::span<T const>(X)).regression(
+      [](T x) { return std::log(x); },
+      [n](std::size_t indx, T) { return std::log(-std::log(1 - ((static_cast<T>(indx) + 0.5) * n))); },
+      workspace);
 
     std::pair<T, T> rv;
 
-    rv.second = r.first;
-    rv.first = std::exp(-r.second / r.first);
+    rv.second = static_cast<T>(r.first);
+    rv.first = static_cast<T>(std::exp(-r.second / r.first));
 
     return rv;
 
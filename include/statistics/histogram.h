@@ -0,0 +1,346 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								histogram.h
+// SUBSYSTEM:						Statistics Functions.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Histograms of large arrays. The bins are either of fixed width or have arbitrary (increasing) edges.
+//                        - Fixed width: the bin is found by a multiplication, there is no search. (A value within an ulp of
+//                          an edge may be counted in the neighbouring bin.)
+//                        - Variable edges: a branch-free binary search. Several values are searched together so that the
+//                          loads of the searches overlap.
+//                        - Freedman-Diaconis: the bin width is 2 * IQR / n^(1/3), the range is the range of the data.
+//                      Bins are closed on the left and open on the right, except the last bin which also includes the upper edge.
+//                      Values outside the edges are counted as underflow or overflow and NaN values are counted separately.
+//                      fill() is multi-threaded. Each thread fills a private copy of the counts in the workspace and the copies
+//                      are added at the end. Histograms with the same edges can be merged, and written to and read from a stream.
+//                      The stream layout (version 1, little-endian) is:
+//                        offset  0: char[8]   magic "MCLHISTO"
+//                        offset  8: uint16    version
+//                        offset 10: uint16    flags (bit 0: fixed width)
+//                        offset 12: uint32    reserved (0)
+//                        offset 16: uint64    number of bins (n)
+//                        offset 24: uint64    underflow, overflow, NaN counts
+//                        offset 48: double    edges[n + 1]
+//                        then:      uint64    counts[n]
+//
+// CLASSES INCLUDED:    histogram_t
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_STATISTICS_HISTOGRAM_H
+#define MCL_STATISTICS_HISTOGRAM_H
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+  // MCL Library header files
+
+#include "../config.h"
+#include "../utility/instrument.h"
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
+#include "missing.hpp"
+
+namespace MCL
+{
+  std::uint16_t constexpr HISTOGRAM_VERSION = 1;
+  std::size_t constexpr HISTOGRAM_LANES = 8;      ///< Number of values searched together when the edges are variable.
+
+  class histogram_t
+  {
+  private:
+    std::vector<FP_t> edges_;
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t underflow_ = 0;
+    std::uint64_t overflow_ = 0;
+    std::uint64_t nan_ = 0;
+    bool fixed_ = false;
+    FP_t scale_ = 0;                              ///< Bins per unit. (Fixed width only.)
+
+    histogram_t() = default;
+
+    /// @brief      Returns the slot of a value. Slot 0 is underflow, slots 1..n are the bins, slot n + 1 is overflow and
+    ///             slot n + 2 is NaN.
+    /// @param[in]  value: The value.
+    /// @returns    The slot.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::size_t slotFixed(FP_t value) const noexcept
+    {
+      FP_t const last = static_cast<FP_t>(counts_.size() - 1);
+      FP_t t = (value - edges_.front()) * scale_;
+
+      t = (t >= 0) ? t : 0;                         // Also replaces NaN.
+      t = (t <= last) ? t : last;
+
+      std::size_t slot = 1 + static_cast<std::size_t>(t);
+      slot = (value < edges_.front()) ? 0 : slot;
+      slot = (value > edges_.back()) ? counts_.size() + 1 : slot;
+      return (value != value) ? counts_.size() + 2 : slot;
+    }
+
+    /// @brief      Returns the slot of a value in a bin found by the search. (See slotFixed.)
+    /// @param[in]  value: The value.
+    /// @param[in]  bin: The last bin with a lower edge not above the value.
+    /// @returns    The slot.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::size_t slotSearched(FP_t value, std::size_t bin) const noexcept
+    {
+      std::size_t slot = 1 + bin;
+      slot = (value < edges_.front()) ? 0 : slot;
+      slot = (value > edges_.back()) ? counts_.size() + 1 : slot;
+      return (value != value) ? counts_.size() + 2 : slot;
+    }
+
+    /// @brief      Returns the last bin with a lower edge not above the value. (0 if the value is below the first edge
+    ///             or NaN.)
+    /// @param[in]  value: The value.
+    /// @returns    The bin.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::size_t search(FP_t value) const noexcept
+    {
+      std::size_t bin = 0;
+
+      for (std::size_t n = counts_.size(); n > 1; n -= n / 2)
+      {
+        bin += (edges_[bin + n / 2] <= value) ? n / 2 : 0;
+      };
+
+      return bin;
+    }
+
+    /// @brief      Counts a block of values into slots.
+    /// @param[in]  data: The values.
+    /// @param[out] slots: The slot counts. (n + 3 values, see slotFixed.)
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    void fillThread(std::span<T const> data, std::uint64_t *slots) const noexcept
+    {
+      std::size_t index = 0;
+
+      if (fixed_)
+      {
+        for (; index < data.size(); index++)
+        {
+          slots[slotFixed(static_cast<FP_t>(data[index]))]++;
+        };
+      }
+      else
+      {
+        for (; index + HISTOGRAM_LANES <= data.size(); index += HISTOGRAM_LANES)
+        {
+          FP_t values[HISTOGRAM_LANES];
+          std::size_t bins[HISTOGRAM_LANES] = {};
+
+          for (std::size_t lane = 0; lane < HISTOGRAM_LANES; lane++)
+          {
+            values[lane] = static_cast<FP_t>(data[index + lane]);
+          };
+
+          for (std::size_t n = counts_.size(); n > 1; n -= n / 2)
+          {
+            for (std::size_t lane = 0; lane < HISTOGRAM_LANES; lane++)
+            {
+              bins[lane] += (edges_[bins[lane] + n / 2] <= values[lane]) ? n / 2 : 0;
+            };
+          };
+
+          for (std::size_t lane = 0; lane < HISTOGRAM_LANES; lane++)
+          {
+            slots[slotSearched(values[lane], bins[lane])]++;
+          };
+        };
+
+        for (; index < data.size(); index++)
+        {
+          FP_t value = static_cast<FP_t>(data[index]);
+          slots[slotSearched(value, search(value))]++;
+        };
+      };
+    }
+
+  protected:
+  public:
+    histogram_t(FP_t lower, FP_t upper, std::size_t bins);
+    explicit histogram_t(std::vector<FP_t> edges);
+
+    histogram_t(histogram_t const &) = default;
+    histogram_t(histogram_t &&) = default;
+    histogram_t &operator=(histogram_t const &) = default;
+    histogram_t &operator=(histogram_t &&) = default;
+
+    /// @brief      Creates an empty histogram with Freedman-Diaconis bins for the data. NaN values are ignored.
+    /// @param[in]  data: The values.
+    /// @param[in]  maxBins: The maximum number of bins.
+    /// @param[in]  workspace: Scratch memory for the sorted copy of the values.
+    /// @returns    The histogram. (The data is not added.)
+    /// @throws     std::invalid_argument - There are no values that are not NaN, or maxBins is zero.
+    /// @throws     std::bad_alloc
+    /// @note       If the interquartile range is zero, Sturges' rule (log2(n) + 1 bins) is used instead.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    static histogram_t freedmanDiaconis(std::span<T const> data, std::size_t maxBins = 1 << 16,
+                                        workspace_t &workspace = workspace_t::local())
+    {
+      if (maxBins == 0)
+      {
+        throw std::invalid_argument("MCL::histogram_t - The maximum number of bins must be greater than zero.");
+      };
+
+      workspace_t::scope_t scope(workspace);
+      std::span<T const> sorted = *detail::sortedValid(data, missing_t{ .policy = MISSING_SKIP }, workspace);
+
+      if (sorted.empty())
+      {
+        throw std::invalid_argument("MCL::histogram_t - No values to determine the bins.");
+      };
+
+      FP_t lower = static_cast<FP_t>(sorted.front());
+      FP_t upper = static_cast<FP_t>(sorted.back());
+      FP_t n = static_cast<FP_t>(sorted.size());
+      FP_t width = 2 * (detail::percentileSorted(sorted, 0.75) - detail::percentileSorted(sorted, 0.25)) / std::cbrt(n);
+      FP_t bins;
+
+      if (lower == upper)
+      {
+        return histogram_t(lower - 0.5, upper + 0.5, 1);
+      }
+      else if (width > 0)
+      {
+        bins = std::ceil((upper - lower) / width);
+      }
+      else
+      {
+        bins = std::ceil(std::log2(n)) + 1;
+      };
+
+      return histogram_t(lower, upper, static_cast<std::size_t>(std::clamp(bins, FP_t{1}, static_cast<FP_t>(maxBins))));
+    }
+
+    /// @brief      Adds a value.
+    /// @param[in]  value: The value to add.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void add(FP_t value) noexcept
+    {
+      std::size_t slot = fixed_ ? slotFixed(value) : slotSearched(value, search(value));
+
+      if (slot == 0)
+      {
+        underflow_++;
+      }
+      else if (slot <= counts_.size())
+      {
+        counts_[slot - 1]++;
+      }
+      else if (slot == counts_.size() + 1)
+      {
+        overflow_++;
+      }
+      else
+      {
+        nan_++;
+      };
+    }
+
+    /// @brief      Adds an array of values.
+    /// @param[in]  data: The values to add.
+    /// @param[in]  workspace: Scratch memory for the counts of the threads.
+    /// @throws     std::bad_alloc
+    /// @note       This function is multi-threaded.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    void fill(std::span<T const> data, workspace_t &workspace = workspace_t::local())
+    {
+      MCL_INSTRUMENT_KERNEL("histogram", data.size(), data.size() * sizeof(T));
+
+      std::size_t const slotCount = counts_.size() + 3;
+      std::size_t const stride = (slotCount + 7) & ~std::size_t{7};       // Separate cache lines for each thread.
+
+      workspace_t::scope_t scope(workspace);
+      std::size_t const numberOfThreads = threadCount(data.size());
+      std::span<std::uint64_t> slots = workspace.allocate<std::uint64_t>(numberOfThreads * stride);
+
+      std::fill(slots.begin(), slots.end(), 0);
+
+      parallelFor(data.size(), numberOfThreads, [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+      {
+        fillThread(data.subspan(indexBegin, indexEnd - indexBegin), slots.data() + threadNumber * stride);
+      });
+
+      for (std::size_t thread = 0; thread < numberOfThreads; thread++)
+      {
+        std::uint64_t const *threadSlots = slots.data() + thread * stride;
+
+        underflow_ += threadSlots[0];
+        for (std::size_t bin = 0; bin < counts_.size(); bin++)
+        {
+          counts_[bin] += threadSlots[bin + 1];
+        };
+        overflow_ += threadSlots[counts_.size() + 1];
+        nan_ += threadSlots[counts_.size() + 2];
+      };
+    }
+
+    void merge(histogram_t const &);
+    void clear() noexcept;
+
+    void serialise(std::ostream &) const;
+    static histogram_t deserialise(std::istream &);
+
+    std::size_t bins() const noexcept { return counts_.size(); }
+    bool fixedWidth() const noexcept { return fixed_; }
+    std::span<FP_t const> edges() const noexcept { return edges_; }
+    std::span<std::uint64_t const> counts() const noexcept { return counts_; }
+    std::uint64_t underflow() const noexcept { return underflow_; }
+    std::uint64_t overflow() const noexcept { return overflow_; }
+    std::uint64_t nan() const noexcept { return nan_; }
+    std::uint64_t total() const noexcept;
+
+    bool operator==(histogram_t const &) const noexcept = default;
+  };
+
+}  // namespace MCL
+
+#endif // MCL_STATISTICS_HISTOGRAM_H
@@ -0,0 +1,305 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								integral.hpp
+// SUBSYSTEM:						Statistics Functions.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Exact accumulation for integral element types. sum(), mean() and variance() use these kernels when the
+//                      element type is an integer (not bool) and the compiler has a 128-bit integer type. The values are only
+//                      converted to floating point at the end.
+//                        - Values of up to 32 bits are summed in 64-bit accumulators over blocks of INTEGRAL_BLOCK values, which
+//                          are then added into a 128-bit total. The inner loops are plain integer adds that the compiler
+//                          vectorises.
+//                        - 64-bit values are summed in 128 bits.
+//                        - The sum of squares is held in 128 bits. (For values of up to 16 bits the squares of a block are summed
+//                          in 64 bits first.)
+//                        - The results of the threads are added exactly, so the result does not depend on the number of threads.
+//                      The variance is (n * sum(x^2) - sum(x)^2) / (n * (n - 1)), with the numerator calculated exactly. There is
+//                      no cancellation, unlike the single-pass floating point formula. If the sum of squares or the numerator
+//                      does not fit in 128 bits (in practice only with 64-bit values) the floating point kernel is used instead.
+//
+// FUNCTIONS INCLUDED:  integralSum(...)
+//                      integralMoments(...)
+//                      integralMean(...)
+//                      integralVariance(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_STATISTICS_INTEGRAL_HPP
+#define MCL_STATISTICS_INTEGRAL_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+  // MCL Library header files
+
+#include "../config.h"
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
+
+namespace MCL
+{
+  std::size_t constexpr INTEGRAL_BLOCK = std::size_t{1} << 20;      ///< Values summed in 64 bits before the 128-bit total.
+
+  namespace detail
+  {
+#ifdef __SIZEOF_INT128__
+    using int128_t = __int128;
+    using uint128_t = unsigned __int128;
+
+    /// @brief True if the exact kernels are used for the type.
+
+    template<typename T>
+    bool constexpr exactIntegral_v = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+    /// @brief Exact sums of a series of integers.
+
+    struct integralMoments_t
+    {
+      std::uint64_t count;
+      int128_t sum;
+      uint128_t sumSquares;
+      bool overflow;                              ///< The sum of squares overflowed.
+    };
+
+    /// @brief      Sums an array of integers exactly.
+    /// @param[in]  data: The values.
+    /// @param[in]  count: The number of values.
+    /// @returns    The sum.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    int128_t integralSum(T const *data, std::size_t count) noexcept
+    {
+      int128_t total = 0;
+
+      if constexpr (sizeof(T) <= 4)
+      {
+        for (std::size_t block = 0; block < count; block += INTEGRAL_BLOCK)
+        {
+          std::size_t blockEnd = std::min(count, block + INTEGRAL_BLOCK);
+          std::int64_t lane = 0;
+
+          for (std::size_t index = block; index < blockEnd; index++)
+          {
+            lane += static_cast<std::int64_t>(data[index]);
+          };
+
+          total += lane;
+        };
+      }
+      else
+      {
+        for (std::size_t index = 0; index < count; index++)
+        {
+          total += static_cast<int128_t>(data[index]);
+        };
+      };
+
+      return total;
+    }
+
+    /// @brief      Sums an array of integers and their squares exactly.
+    /// @param[in]  data: The values.
+    /// @param[in]  count: The number of values.
+    /// @returns    The count, sum and sum of squares.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    integralMoments_t integralMoments(T const *data, std::size_t count) noexcept
+    {
+      integralMoments_t moments{ count, 0, 0, false };
+
+      if constexpr (sizeof(T) <= 4)
+      {
+        for (std::size_t block = 0; block < count; block += INTEGRAL_BLOCK)
+        {
+          std::size_t blockEnd = std::min(count, block + INTEGRAL_BLOCK);
+          std::int64_t lane = 0;
+
+          if constexpr (sizeof(T) <= 2)
+          {
+            std::uint64_t squares = 0;
+
+            for (std::size_t index = block; index < blockEnd; index++)
+            {
+              std::int64_t value = static_cast<std::int64_t>(data[index]);
+
+              lane += value;
+              squares += static_cast<std::uint64_t>(value * value);
+            };
+
+            moments.sumSquares += squares;
+          }
+          else
+          {
+            for (std::size_t index = block; index < blockEnd; index++)
+            {
+              std::int64_t value = static_cast<std::int64_t>(data[index]);
+
+                // The square of a 32-bit value can exceed the range of int64_t (uint32_t), but is exact in uint64_t.
+
+              lane += value;
+              moments.sumSquares += static_cast<std::uint64_t>(value) * static_cast<std::uint64_t>(value);
+            };
+          };
+
+          moments.sum += lane;
+        };
+      }
+      else
+      {
+        for (std::size_t index = 0; index < count; index++)
+        {
+          int128_t value = static_cast<int128_t>(data[index]);
+          uint128_t magnitude = static_cast<uint128_t>(value < 0 ? -value : value);
+
+          moments.sum += value;
+          moments.overflow |= __builtin_add_overflow(moments.sumSquares, magnitude * magnitude, &moments.sumSquares);
+        };
+      };
+
+      return moments;
+    }
+
+    /// @brief      Multi-threaded exact sum of an array of integers.
+    /// @param[in]  data: The values.
+    /// @param[in]  count: The number of values.
+    /// @param[in]  workspace: Scratch memory for the results of the threads.
+    /// @returns    The sum.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    int128_t integralSum(T const *data, std::size_t count, workspace_t &workspace)
+    {
+      workspace_t::scope_t scope(workspace);
+      std::span<int128_t> sums = workspace.allocate<int128_t>(threadCount(count));
+      int128_t total = 0;
+
+      std::size_t numberOfThreads = parallelFor(count, sums.size(),
+                                                [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+      {
+        sums[threadNumber] = integralSum(data + indexBegin, indexEnd - indexBegin);
+      });
+
+      for (std::size_t index = 0; index < numberOfThreads; index++)
+      {
+        total += sums[index];
+      };
+
+      return total;
+    }
+
+    /// @brief      Multi-threaded exact sum and sum of squares of an array of integers.
+    /// @param[in]  data: The values.
+    /// @param[in]  count: The number of values.
+    /// @param[in]  workspace: Scratch memory for the results of the threads.
+    /// @returns    The count, sum and sum of squares.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    integralMoments_t integralMoments(T const *data, std::size_t count, workspace_t &workspace)
+    {
+      workspace_t::scope_t scope(workspace);
+      std::span<integralMoments_t> partials = workspace.allocate<integralMoments_t>(threadCount(count));
+      integralMoments_t total{ count, 0, 0, false };
+
+      std::size_t numberOfThreads = parallelFor(count, partials.size(),
+                                                [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+      {
+        partials[threadNumber] = integralMoments(data + indexBegin, indexEnd - indexBegin);
+      });
+
+      for (std::size_t index = 0; index < numberOfThreads; index++)
+      {
+        total.sum += partials[index].sum;
+        total.overflow |= partials[index].overflow;
+        total.overflow |= __builtin_add_overflow(total.sumSquares, partials[index].sumSquares, &total.sumSquares);
+      };
+
+      return total;
+    }
+
+    /// @brief      Calculates the mean from an exact sum. The quotient and the remainder are converted separately, so the
+    ///             result is correctly rounded while the quotient is below 2^53.
+    /// @param[in]  sum: The sum.
+    /// @param[in]  count: The number of values. (Not zero.)
+    /// @returns    The mean.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    inline FP_t integralMean(int128_t sum, std::uint64_t count) noexcept
+    {
+      int128_t n = static_cast<int128_t>(count);
+
+      return static_cast<FP_t>(sum / n) + static_cast<FP_t>(sum % n) / static_cast<FP_t>(count);
+    }
+
+    /// @brief      Calculates the sample variance from exact sums.
+    /// @param[in]  moments: The count (at least two), sum and sum of squares.
+    /// @returns    The variance. No value if the sums or their products overflow 128 bits.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    inline std::optional<FP_t> integralVariance(integralMoments_t const &moments) noexcept
+    {
+      if (moments.overflow)
+      {
+        return std::nullopt;
+      };
+
+      uint128_t n = moments.count;
+      uint128_t magnitude = static_cast<uint128_t>(moments.sum < 0 ? -moments.sum : moments.sum);
+      uint128_t nS2, S1S1;
+      FP_t denominator = static_cast<FP_t>(moments.count) * static_cast<FP_t>(moments.count - 1);
+
+      if (!__builtin_mul_overflow(n, moments.sumSquares, &nS2) && !__builtin_mul_overflow(magnitude, magnitude, &S1S1))
+      {
+        return static_cast<FP_t>(nS2 - S1S1) / denominator;
+      }
+      else
+      {
+        return std::nullopt;
+      };
+    }
+#else
+    template<typename T>
+    bool constexpr exactIntegral_v = false;
+#endif
+  }
+
+}  // namespace MCL
+
+#endif // MCL_STATISTICS_INTEGRAL_HPP
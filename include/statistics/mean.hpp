@@ -32,7 +32,9 @@
 //                      mean(valarray)
 //
 //
-// HISTORY:             2023-11-14/GGB - Added function for running mean calculation.
+// HISTORY:             2026-10-19 GGB - Exact accumulation for integral types.
+//                      2026-10-19 GGB - Temporary arrays allocated from a workspace_t.
+//                      2023-11-14/GGB - Added function for running mean calculation.
 //                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2015-07-10/GGB - Added function mean(T *)
 //                      2013-09-30 GGB - astroManager 2013.09 release.
@@ -49,9 +51,8 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <memory>
 #include <optional>
-#include <thread>
+#include <span>
 #include <valarray>
 #include <utility>
 #include <vector>
@@ -63,6 +64,9 @@
   // MCL Library header files
 
 #include "../config.h"
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
+#include "integral.hpp"
 
 /// @file
 /// The file provides a number of templated mean functions. These functions are provided in bost single-thread and multi-threaded
@@ -253,20 +257,21 @@ namespace MCL
   /// @brief Calculate the mean of a c-style array of data.
   /// @param[in] data: The data array
   /// @param[in] len: The number of samples in the array
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
   /// @returns The mean of the values in the array.
-  /// @throws None.
+  /// @throws std::bad_alloc
   /// @note This function is multi-threaded.
+  /// @version 2026-10-19/GGB - Exact accumulation for integral types.
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results.
   /// @version 2018-09-20/GGB - Updated to use std::unique_ptr instead of boost scoped arrays.
   /// @version 2015-07-10/GGB - Function created.
 
   template<typename T>
-  std::optional<FP_t> mean(T *data, size_t len)
+  std::optional<FP_t> mean(T *data, size_t len, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("mean", len, len * sizeof(T));
+
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    std::vector<std::thread> threadGroup;
-    size_t indexBegin = 0, indexEnd = 0;
     size_t index;
     FP_t returnValue = 0;
     size_t count = len;
@@ -277,43 +282,19 @@ namespace MCL
     }
     else
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values
-
-      numberOfThreads = count / 1000;
-      if (numberOfThreads == 0)
+      if constexpr (detail::exactIntegral_v<T>)
       {
-        numberOfThreads = 1;
-      }
-      else if (numberOfThreads > maxThreads)
-      {
-        numberOfThreads = maxThreads;
+        return std::optional<FP_t>(detail::integralMean(detail::integralSum(data, count, workspace), count));
       };
 
-      stepSize = count / numberOfThreads;
-
-      std::unique_ptr<size_t []> counts(new size_t[numberOfThreads]);
-      std::unique_ptr<FP_t []> means(new FP_t[numberOfThreads]);
+      workspace_t::scope_t scope(workspace);
+      std::span<size_t> counts = workspace.allocate<size_t>(threadCount(count));
+      std::span<FP_t> means = workspace.allocate<FP_t>(counts.size());
 
-        // Spawn the threads.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
+      numberOfThreads = parallelFor(count, counts.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads - 1) )
-        {
-          indexEnd = count;
-        }
-        else
-        {
-          indexEnd += stepSize;
-        };
-        threadGroup.emplace_back(&meanThread<T>, data, indexBegin, indexEnd, std::ref(means[threadNumber]), std::ref(counts[threadNumber]));
-      };
-
-      for (auto &thread: threadGroup)
-      {
-        thread.join();     // Wait for all the threads to finish.
-      };
+        meanThread<T>(data, indexBegin, indexEnd, means[threadNumber], counts[threadNumber]);
+      });
 
       for(index = 0; index < numberOfThreads; index++)
       {
@@ -326,57 +307,38 @@ namespace MCL
 
   /// @brief Calculate the mean of a valarray
   /// @param[in] data: The data array
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
   /// @returns The mean of the values in the array.
-  /// @throws None.
+  /// @throws std::bad_alloc
   /// @note This function is multi-threaded.
+  /// @version 2026-10-19/GGB - Exact accumulation for integral types.
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results.
   /// @version 2022-11-29/GGB - Function created.
 
   template<typename T>
-  FP_t mean(std::valarray<T> &va)
+  FP_t mean(std::valarray<T> &va, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("mean", va.size(), va.size() * sizeof(T));
+
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    std::vector<std::thread *> threadGroup;
-    std::thread *thread;
-    size_t indexBegin = 0, indexEnd = 0;
     size_t index;
     FP_t returnValue = 0;
 
     if (va.size() != 0)
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values
-
-      numberOfThreads = std::min(std::max(std::size_t {1}, va.size() / 1000), maxThreads);
-
-      stepSize = va.size() / numberOfThreads;
-
-      std::unique_ptr<size_t []> counts(new size_t[numberOfThreads]);
-      std::unique_ptr<FP_t []> means(new FP_t[numberOfThreads]);
-
-        // Spawn the threads.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
+      if constexpr (detail::exactIntegral_v<T>)
       {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads - 1) )
-        {
-          indexEnd = va.size();
-        }
-        else
-        {
-          indexEnd += stepSize;
-        };
-        thread = new std::thread(&meanThreadVA<T>, boost::ref(va), indexBegin, indexEnd,
-                                 boost::ref(means[threadNumber]), boost::ref(counts[threadNumber]));
-        threadGroup.push_back(thread);
-        thread = nullptr;
+        return detail::integralMean(detail::integralSum(std::begin(va), va.size(), workspace), va.size());
       };
 
-      for (auto &thread: threadGroup)
+      workspace_t::scope_t scope(workspace);
+      std::span<size_t> counts = workspace.allocate<size_t>(threadCount(va.size()));
+      std::span<FP_t> means = workspace.allocate<FP_t>(counts.size());
+
+      numberOfThreads = parallelFor(va.size(), counts.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        thread->join();
-      };
+        meanThreadVA<T>(va, indexBegin, indexEnd, means[threadNumber], counts[threadNumber]);
+      });
 
       for(index = 0; index < numberOfThreads; index++)
       {
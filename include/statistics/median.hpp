@@ -30,7 +30,9 @@
 //
 // FUNCTIONS INCLUDED:  median(...)
 //
-// HISTORY:             2023-11-23 GGB - Added function taking a vector.
+// HISTORY:             2026-10-19 GGB - Added asynchronous overloads.
+//                      2026-10-19 GGB - Temporary arrays allocated from a workspace_t.
+//                      2023-11-23 GGB - Added function taking a vector.
 //                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2013-09-30 GGB - astroManager 2013.09 release.
 //                      2013-07-28 GGB - File Created.
@@ -43,26 +45,35 @@
   // Standard C++ library header files
 
 #include <algorithm>
+#include <span>
 #include <valarray>
 #include <vector>
 
   // MCL Library header files.
 
 #include "../config.h"
+#include "../utility/async.hpp"
+#include "../utility/instrument.h"
 #include "../utility/sort.hpp"
+#include "../utility/workspace.hpp"
 
 namespace MCL
 {
 
   /// @brief      Returns the median value of the data in the array.
   /// @param[in]  data:  The array to analyse for the median.
+  /// @param[in]  workspace: Scratch memory for the sorted copy of the data.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Sorted copy allocated from a workspace.
   /// @version    2023-11-23/GGB - Changed parameter to const & rather than &.
   /// @version    2016-01-15/GGB - Use static_cast rather than C-style casting.
   /// @version    2013-07-28/GGB - Function created.
 
   template<typename T>
-  FP_t median(std::valarray<T> const &data)
+  FP_t median(std::valarray<T> const &data, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("median", data.size(), data.size() * sizeof(T));
+
     size_t elements = data.size();              // Number of elements
 
     if (elements == 0)
@@ -79,8 +90,11 @@ namespace MCL
     }
     else
     {
-      std::valarray<T> dataCopy(data);
-      MCL::sort(std::begin(dataCopy), std::end(dataCopy));     // Sort the array
+      workspace_t::scope_t scope(workspace);
+      std::span<T> dataCopy = workspace.allocate<T>(elements);
+
+      std::copy(std::begin(data), std::end(data), dataCopy.begin());
+      MCL::sort(dataCopy.begin(), dataCopy.end());     // Sort the array
 
       if ( (elements & 1) == 0)
       {
@@ -103,12 +117,17 @@ namespace MCL
 
   /// @brief      Returns the median value of the data in the array.
   /// @param[in]  data:  The array to analyse for the median.
+  /// @param[in]  workspace: Scratch memory for the sorted copy of the data.
   /// @returns    The median value.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Sorted copy allocated from a workspace.
   /// @version    2023-11-23/GGB - Function created.
 
   template<typename T>
-  FP_t median(std::vector<T> const &data)
+  FP_t median(std::vector<T> const &data, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("median", data.size(), data.size() * sizeof(T));
+
     size_t elements = data.size();              // Number of elements
 
     if (elements == 0)
@@ -125,8 +144,11 @@ namespace MCL
     }
     else
     {
-      std::vector<T> dataCopy(data);
-      MCL::sort(std::begin(dataCopy), std::end(dataCopy));     // Sort the array
+      workspace_t::scope_t scope(workspace);
+      std::span<T> dataCopy = workspace.allocate<T>(elements);
+
+      std::copy(std::begin(data), std::end(data), dataCopy.begin());
+      MCL::sort(dataCopy.begin(), dataCopy.end());     // Sort the array
 
       if ( (elements & 1) == 0)
       {
@@ -147,6 +169,32 @@ namespace MCL
     };
   }
 
+  /// @brief      Returns the median value of the data in the array, calculated on an executor.
+  /// @param[in]  options: The stop token, deadline and executor for the call.
+  /// @param[in]  data:  The array to analyse for the median.
+  /// @returns    A future for the median.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::future<FP_t> median(asyncOptions_t const &options, std::valarray<T> data)
+  {
+    return MCL::async(options, [data = std::move(data)]() { return median(data); });
+  }
+
+  /// @brief      Returns the median value of the data in the vector, calculated on an executor.
+  /// @param[in]  options: The stop token, deadline and executor for the call.
+  /// @param[in]  data:  The vector to analyse for the median.
+  /// @returns    A future for the median.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::future<FP_t> median(asyncOptions_t const &options, std::vector<T> data)
+  {
+    return MCL::async(options, [data = std::move(data)]() { return median(data); });
+  }
+
 }   // namespace MCL
 
 #endif // MCL_MEDIAN_HPP
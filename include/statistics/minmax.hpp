@@ -5,7 +5,7 @@
 // SUBSYSTEM:						Statistics Functions.
 // LANGUAGE:						C++
 // TARGET OS:						WINDOWS/UNIX/LINUX/MAC
-// LIBRARY DEPENDANCE:	boost
+// LIBRARY DEPENDANCE:	None.
 // NAMESPACE:						MCL
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
@@ -31,7 +31,8 @@
 // FUNCTIONS INCLUDED:  MinMax(...)
 //
 //
-// HISTORY:             2018-09-19 GGB - Change boost::optional to std::optional
+// HISTORY:             2026-10-19 GGB - Temporary arrays allocated from a workspace_t.
+//                      2018-09-19 GGB - Change boost::optional to std::optional
 //                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2013-09-30 GGB - astroManager 2013.09 release.
 //                      2013-08-02/GGB - Updated to 64bit compliance.
@@ -48,9 +49,8 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <memory>
 #include <optional>
-#include <thread>
+#include <span>
 #include <tuple>
 #include <valarray>
 #include <vector>
@@ -58,6 +58,8 @@
   // MCL Library
 
 #include "../config.h"
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
 
 namespace MCL
 {
@@ -134,6 +136,8 @@ namespace MCL
   template<typename T>
   bool minmax(T *data, size_t dataCount, T &minValue, T &maxValue)
   {
+    MCL_INSTRUMENT_KERNEL("minmax", dataCount, dataCount * sizeof(T));
+
     size_t index;
 
     if (dataCount == 0)
@@ -184,20 +188,18 @@ namespace MCL
 
   /// @brief Function to determine the maximum value in an array.
   /// @param[in] data: The valarray with the data.
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results. Include the last value.
   /// @version 2018-09-19/GGB - Use and return std::optional instead of boost::optional.
   /// @version 2013-08-02/GGB - Updated to use valarray const & and T for data.
   /// @version 2012-11-30/GGB - Function created.
 
   template<typename T>
-  std::optional<T> max(std::valarray<T> const &data)
+  std::optional<T> max(std::valarray<T> const &data, workspace_t &workspace = workspace_t::local())
   {
-    size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    boost::thread_group threadGroup;
-    boost::thread *thread;
+    MCL_INSTRUMENT_KERNEL("max", data.size(), data.size() * sizeof(T));
 
-    size_t indexBegin, indexEnd = 0;
+    size_t numberOfThreads;
     size_t index;
     T returnValue = 0;
 
@@ -207,35 +209,13 @@ namespace MCL
     }
     else
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values.
-
-      numberOfThreads = data.size() / 1000;
-
-      numberOfThreads = std::max(maxThreads, std::min(numberOfThreads, std::size_t{1}));
-
-      stepSize = data.size() / numberOfThreads;
-
-      std::unique_ptr<T []> maxs(new T[numberOfThreads]);
-
-        // Spawn the threads.
+      workspace_t::scope_t scope(workspace);
+      std::span<T> maxs = workspace.allocate<T>(threadCount(data.size()));
 
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
+      numberOfThreads = parallelFor(data.size(), maxs.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads -1) )
-        {
-          indexEnd = data.size() -1;
-        }
-        else
-        {
-          indexEnd += stepSize;
-        };
-        thread = new boost::thread(&maxThread<T>, boost::cref(data), indexBegin, indexEnd, boost::ref(maxs[threadNumber]));
-        threadGroup.add_thread(thread);
-        thread = nullptr;
-      };
-
-      threadGroup.join_all();     // Wait for all the threads to finish.
+        maxThread<T>(data, indexBegin, indexEnd, maxs[threadNumber]);
+      });
 
       returnValue = maxs[0];
 
@@ -274,19 +254,18 @@ namespace MCL
 
   /// @brief Function to determine the minimum value in an array.
   /// @param[in] data: The array to search.
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results. Include the last value.
   /// @version 2018-09-19/GGB - Use and return std::optional instead of boost::optional.
   /// @version 2013-08-02/GGB - Updated to use valarray const & and T for data.
   /// @version 2012-11-30/GGB - Function created.
 
   template<typename T>
-  std::optional<T> min(std::valarray<T> const &data)
+  std::optional<T> min(std::valarray<T> const &data, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("min", data.size(), data.size() * sizeof(T));
+
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    boost::thread_group threadGroup;
-    boost::thread *thread;
-    size_t indexBegin, indexEnd = 0;
     size_t index;
     T returnValue = 0;
 
@@ -296,41 +275,13 @@ namespace MCL
     }
     else
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values.
+      workspace_t::scope_t scope(workspace);
+      std::span<T> mins = workspace.allocate<T>(threadCount(data.size()));
 
-      numberOfThreads = data.size() / 1000;
-      if (numberOfThreads == 0)
+      numberOfThreads = parallelFor(data.size(), mins.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        numberOfThreads = 1;
-      }
-      else if (numberOfThreads > maxThreads)
-      {
-        numberOfThreads = maxThreads;
-      }
-
-      stepSize = data.size() / numberOfThreads;
-
-      std::unique_ptr<T []> mins(new T[numberOfThreads]);
-
-        // Spawn the threads.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
-      {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads -1) )
-        {
-          indexEnd = data.size() -1;
-        }
-        else
-        {
-          indexEnd += stepSize;
-        };
-        thread = new boost::thread(&minThread<T>, boost::cref(data), indexBegin, indexEnd, boost::ref(mins[threadNumber]));
-        threadGroup.add_thread(thread);
-        thread = nullptr;
-      };
-
-      threadGroup.join_all();     // Wait for all the threads to finish.
+        minThread<T>(data, indexBegin, indexEnd, mins[threadNumber]);
+      });
 
       returnValue = mins[0];
 
@@ -406,20 +357,17 @@ namespace MCL
   /// @brief Function to determine the minimum value in an array.
   /// @param[in] data: The data array
   /// @param[in] dataCount: The number of elements in the array.
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
   /// @returns The min and max value of the elements within the array.
-  /// @throws None.
+  /// @throws std::bad_alloc
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results.
   /// @version 2018-09-19/GGB - Use and return std::optional instead of boost::optional.
   /// @version 2015-08-30/GGB - Function created.
 
   template<typename T>
-  std::optional<std::tuple<T, T> > minmax(T *data, size_t dataCount)
+  std::optional<std::tuple<T, T> > minmax(T *data, size_t dataCount, workspace_t &workspace = workspace_t::local())
   {
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    boost::thread_group threadGroup;
-    boost::thread *thread;
-    size_t indexBegin, indexEnd = 0;
     size_t index;
     T max = 0;
     T min = 0;
@@ -430,44 +378,14 @@ namespace MCL
     }
     else
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values.
+      workspace_t::scope_t scope(workspace);
+      std::span<T> maxs = workspace.allocate<T>(threadCount(dataCount));
+      std::span<T> mins = workspace.allocate<T>(maxs.size());
 
-      numberOfThreads = dataCount / 1000;
-
-      if (numberOfThreads == 0)
-      {
-        numberOfThreads = 1;
-      }
-      else if (numberOfThreads > maxThreads)
+      numberOfThreads = parallelFor(dataCount, maxs.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        numberOfThreads = maxThreads;
-      };
-
-      stepSize = dataCount / numberOfThreads;
-
-      std::unique_ptr<T []> maxs(new T[numberOfThreads]);
-      std::unique_ptr<T []> mins(new T[numberOfThreads]);
-
-        // Spawn the threads.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
-      {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads -1) )
-        {
-          indexEnd = dataCount;
-        }
-        else
-        {
-          indexEnd += stepSize;
-        };
-        thread = new boost::thread(&minmaxThread<T>, boost::cref(data), indexBegin, indexEnd,
-                                   boost::ref(mins[threadNumber]), boost::ref(maxs[threadNumber]));
-        threadGroup.add_thread(thread);
-        thread = nullptr;
-      };
-
-      threadGroup.join_all();     // Wait for all the threads to finish.
+        minmaxThread<T>(data, indexBegin, indexEnd, mins[threadNumber], maxs[threadNumber]);
+      });
 
       min = mins[0];
       max = maxs[0];
@@ -491,19 +409,18 @@ namespace MCL
 
   /// @brief Function to determine the maximum and minimum values in a valarray.
   /// @param[in] va: The data array
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
   /// @returns The min and max value of the elements within the array.
-  /// @throws None.
+  /// @throws std::bad_alloc
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results.
   /// @version 2022-11-29/GGB - Function created.
 
   template<typename T>
-  std::pair<T, T> minmax(std::valarray<T> const &va)
+  std::pair<T, T> minmax(std::valarray<T> const &va, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("minmax", va.size(), va.size() * sizeof(T));
+
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    std::vector<std::thread *> threadGroup;
-    std::thread *thread;
-    size_t indexBegin, indexEnd = 0;
     size_t index;
     T max = 0;
     T min = 0;
@@ -514,38 +431,14 @@ namespace MCL
     }
     else
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values.
-
-      numberOfThreads = std::min(std::max(std::size_t{1}, va.size() / 1000), maxThreads);
-
-      stepSize = va.size() / numberOfThreads;
-
-      std::unique_ptr<T []> maxs(new T[numberOfThreads]);
-      std::unique_ptr<T []> mins(new T[numberOfThreads]);
-
-        // Spawn the threads.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
-      {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads -1) )
-        {
-          indexEnd = va.size();
-        }
-        else
-        {
-          indexEnd += stepSize;
-        };
-        thread = new std::thread(&minmaxThreadva<T>, boost::cref(va), indexBegin, indexEnd,
-                                   boost::ref(mins[threadNumber]), boost::ref(maxs[threadNumber]));
-        threadGroup.push_back(thread);
-        thread = nullptr;
-      };
+      workspace_t::scope_t scope(workspace);
+      std::span<T> maxs = workspace.allocate<T>(threadCount(va.size()));
+      std::span<T> mins = workspace.allocate<T>(maxs.size());
 
-      for (auto &thread: threadGroup)
+      numberOfThreads = parallelFor(va.size(), maxs.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        thread->join();
-      }
+        minmaxThreadva<T>(va, indexBegin, indexEnd, mins[threadNumber], maxs[threadNumber]);
+      });
 
       min = mins[0];
       max = maxs[0];
@@ -0,0 +1,419 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								missing.hpp
+// SUBSYSTEM:						Statistics Functions.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Statistics of data with missing values. Each function takes a missing_t that selects how NaN values and
+//                      sentinel values are treated, and an optional validity bitmask (bit i set if value i is valid, as in Apache
+//                      Arrow).
+//                        MISSING_PROPAGATE: NaN values are used, so a NaN makes the result NaN. (As the other functions.)
+//                        MISSING_SKIP: NaN values are skipped.
+//                        MISSING_SENTINEL: NaN values and values equal to the sentinel are skipped.
+//                      Values cleared in the validity mask are skipped under all the policies.
+//                      The reductions and the regression are pipelines (pipeline.hpp) with a validity filter, so the missing
+//                      values are masked out in the reduction pass, without branches or a filtered copy. The order statistics
+//                      compact the valid values into the sorted copy that they make in any case, so NaN values never reach the
+//                      sort.
+//
+// FUNCTIONS INCLUDED:  sum(...)
+//                      mean(...)
+//                      variance(...)
+//                      stdev(...)
+//                      minmax(...)
+//                      summary(...)
+//                      median(...)
+//                      percentile(...)
+//                      linearRegression(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_STATISTICS_MISSING_HPP
+#define MCL_STATISTICS_MISSING_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+  // MCL Library header files
+
+#include "../config.h"
+#include "../utility/sort.hpp"
+#include "../utility/workspace.hpp"
+#include "pipeline.hpp"
+#include "summary.hpp"
+
+namespace MCL
+{
+  enum missing_e
+  {
+    MISSING_PROPAGATE,
+    MISSING_SKIP,
+    MISSING_SENTINEL,
+  };
+
+  /// @brief How missing values are identified.
+
+  struct missing_t
+  {
+    missing_e policy = MISSING_SKIP;
+    FP_t sentinel = 0;                              ///< MISSING_SENTINEL: Values equal to the sentinel are missing.
+    std::span<std::uint64_t const> validity{};      ///< Bit (i % 64) of word (i / 64) set if value i is valid. (Empty: all valid.)
+  };
+
+  namespace detail
+  {
+    /// @brief      Determines if a value is valid. (Branch-free, apart from the test for a mask.)
+    /// @param[in]  missing: The policy.
+    /// @param[in]  index: The index of the value.
+    /// @param[in]  value: The value.
+    /// @returns    true if the value is to be used.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    bool valid(missing_t const &missing, std::size_t index, T value) noexcept
+    {
+      bool keep = missing.validity.empty() || static_cast<bool>((missing.validity[index >> 6] >> (index & 63)) & 1);
+
+      if constexpr (std::is_floating_point_v<T>)
+      {
+        keep = keep & ((missing.policy == MISSING_PROPAGATE) | (value == value));
+      };
+
+      return keep & ((missing.policy != MISSING_SENTINEL) | (static_cast<FP_t>(value) != missing.sentinel));
+    }
+
+    /// @brief      Copies the valid values into the workspace and sorts them.
+    /// @param[in]  data: The values.
+    /// @param[in]  missing: The policy.
+    /// @param[in]  workspace: The workspace for the copy. (The caller holds the scope.)
+    /// @returns    The sorted valid values. No value if the policy is MISSING_PROPAGATE and a NaN is present.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    std::optional<std::span<T>> sortedValid(std::span<T const> data, missing_t const &missing, workspace_t &workspace)
+    {
+      std::span<T> copy = workspace.allocate<T>(data.size());
+      std::size_t count = 0;
+      bool nan = false;
+
+      for (std::size_t index = 0; index < data.size(); index++)
+      {
+        T value = data[index];
+        bool keep = valid(missing, index, value);
+
+        copy[count] = value;
+        count += keep;
+        if constexpr (std::is_floating_point_v<T>)
+        {
+          nan = nan | (keep & (value != value));
+        };
+      };
+
+      if (nan)
+      {
+        return std::nullopt;
+      };
+
+      MCL::sort(copy.begin(), copy.begin() + count);
+
+      return copy.first(count);
+    }
+
+    /// @brief      Returns a percentile of sorted values.
+    /// @param[in]  sorted: The sorted values. (Not empty.)
+    /// @param[in]  p: The percentile. [0; 1]
+    /// @returns    The interpolated percentile.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    FP_t percentileSorted(std::span<T const> sorted, FP_t p) noexcept
+    {
+      FP_t d = std::clamp(p * static_cast<FP_t>(sorted.size() + 1), FP_t{1}, static_cast<FP_t>(sorted.size()));
+      std::size_t s1 = static_cast<std::size_t>(std::floor(d)) - 1;
+      std::size_t s2 = static_cast<std::size_t>(std::ceil(d)) - 1;
+
+      FP_t v1 = static_cast<FP_t>(sorted[s1]);
+
+      return v1 + (d - std::floor(d)) * (static_cast<FP_t>(sorted[s2]) - v1);
+    }
+
+    /// @brief      Determines if a valid value is NaN. (Only possible with MISSING_PROPAGATE.) The test is made explicitly,
+    ///             as a NaN cannot be detected from the sum of values that include both +inf and -inf.
+    /// @param[in]  data: The values.
+    /// @param[in]  missing: The policy.
+    /// @returns    true if a valid value is NaN.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    bool validNaN(std::span<T const> data, missing_t const &missing) noexcept
+    {
+      bool nan = false;
+
+      if constexpr (std::is_floating_point_v<T>)
+      {
+        if (missing.policy == MISSING_PROPAGATE)
+        {
+          for (std::size_t index = 0; index < data.size(); index++)
+          {
+            T value = data[index];
+
+            nan = nan | (valid(missing, index, value) & (value != value));
+          };
+        };
+      };
+
+      return nan;
+    }
+
+    /// @brief      Returns a pipeline over the data that skips the missing values.
+    /// @param[in]  data: The values.
+    /// @param[in]  missing: The policy.
+    /// @returns    The pipeline.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    auto validPipeline(std::span<T const> data, missing_t const &missing)
+    {
+      return pipeline(data).filter([&missing](std::size_t index, T value) { return valid(missing, index, value); });
+    }
+  }
+
+  /// @brief      Returns the count, sum, minimum, maximum, mean and variance of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the results of the threads.
+  /// @returns    The summary. If the policy is MISSING_PROPAGATE and a NaN is present, all the statistics (including the
+  ///             minimum and maximum) are NaN.
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  summary_t summary(std::span<T const> data, missing_t const &missing, workspace_t &workspace = workspace_t::local())
+  {
+    if (!missing.validity.empty() && (missing.validity.size() * 64 < data.size()))
+    {
+      throw std::invalid_argument("MCL::summary - Validity mask is shorter than the data.");
+    };
+
+    summary_t s = detail::validPipeline(data, missing).summary(workspace);
+
+    if (detail::validNaN(data, missing))
+    {
+      FP_t constexpr NaN = std::numeric_limits<FP_t>::quiet_NaN();
+
+      s = summary_t(s.count(), NaN, NaN, NaN, NaN);
+    };
+
+    return s;
+  }
+
+  /// @brief      Returns the sum of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the results of the threads.
+  /// @returns    The sum. (Zero if there are no valid values.)
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  FP_t sum(std::span<T const> data, missing_t const &missing, workspace_t &workspace = workspace_t::local())
+  {
+    return summary(data, missing, workspace).sum();
+  }
+
+  /// @brief      Returns the mean of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the results of the threads.
+  /// @returns    The mean. No value if there are no valid values.
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<FP_t> mean(std::span<T const> data, missing_t const &missing, workspace_t &workspace = workspace_t::local())
+  {
+    return summary(data, missing, workspace).mean();
+  }
+
+  /// @brief      Returns the sample variance of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the results of the threads.
+  /// @returns    The variance. No value if there are fewer than two valid values.
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<FP_t> variance(std::span<T const> data, missing_t const &missing, workspace_t &workspace = workspace_t::local())
+  {
+    return summary(data, missing, workspace).variance();
+  }
+
+  /// @brief      Returns the sample standard deviation of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the results of the threads.
+  /// @returns    The standard deviation. No value if there are fewer than two valid values.
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<FP_t> stdev(std::span<T const> data, missing_t const &missing, workspace_t &workspace = workspace_t::local())
+  {
+    std::optional<FP_t> v = variance(data, missing, workspace);
+
+    return v ? std::optional<FP_t>(std::sqrt(*v)) : std::optional<FP_t>();
+  }
+
+  /// @brief      Returns the minimum and maximum of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the results of the threads.
+  /// @returns    The minimum (first) and maximum (second). No value if there are no valid values. NaN if the policy is
+  ///             MISSING_PROPAGATE and a NaN is present.
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<std::pair<FP_t, FP_t>> minmax(std::span<T const> data, missing_t const &missing,
+                                              workspace_t &workspace = workspace_t::local())
+  {
+    summary_t s = summary(data, missing, workspace);
+
+    if (s.count() == 0)
+    {
+      return std::nullopt;
+    }
+    else
+    {
+      return std::make_pair(s.min(), s.max());
+    };
+  }
+
+  /// @brief      Returns a percentile of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  p: The percentile to find. [0; 1]
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the sorted copy of the valid values.
+  /// @returns    The percentile. No value if there are no valid values. NaN if the policy is MISSING_PROPAGATE and a NaN
+  ///             is present.
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<FP_t> percentile(std::span<T const> data, FP_t p, missing_t const &missing,
+                                 workspace_t &workspace = workspace_t::local())
+  {
+    if (!missing.validity.empty() && (missing.validity.size() * 64 < data.size()))
+    {
+      throw std::invalid_argument("MCL::percentile - Validity mask is shorter than the data.");
+    };
+
+    workspace_t::scope_t scope(workspace);
+    std::optional<std::span<T>> sorted = detail::sortedValid(data, missing, workspace);
+
+    if (!sorted)
+    {
+      return std::numeric_limits<FP_t>::quiet_NaN();
+    }
+    else if (sorted->empty())
+    {
+      return std::nullopt;
+    }
+    else
+    {
+      return detail::percentileSorted(std::span<T const>(*sorted), p);
+    };
+  }
+
+  /// @brief      Returns the median of the valid values.
+  /// @param[in]  data: The values.
+  /// @param[in]  missing: How missing values are identified.
+  /// @param[in]  workspace: Scratch memory for the sorted copy of the valid values.
+  /// @returns    The median. No value if there are no valid values. NaN if the policy is MISSING_PROPAGATE and a NaN is
+  ///             present.
+  /// @throws     std::invalid_argument - The validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<FP_t> median(std::span<T const> data, missing_t const &missing, workspace_t &workspace = workspace_t::local())
+  {
+    return percentile(data, 0.5, missing, workspace);
+  }
+
+  /// @brief      Least squares fit of Y = mX + c over the pairs where both X and Y are valid.
+  /// @param[in]  X: The X-values
+  /// @param[in]  Y: The Y-values
+  /// @param[in]  missing: How missing values are identified. (The validity mask applies to the pairs.)
+  /// @param[in]  workspace: Scratch memory for the results of the threads.
+  /// @returns    The slope (first) and intercept (second). (m, C)
+  /// @throws     std::invalid_argument - X and Y are different sizes, or the validity mask is too short.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::pair<FP_t, FP_t> linearRegression(std::span<T const> X, std::span<T const> Y, missing_t const &missing,
+                                         workspace_t &workspace = workspace_t::local())
+  {
+    if (X.size() != Y.size())
+    {
+      throw std::invalid_argument("MCL::linearRegression - X and Y must be equal size.");
+    }
+    else if (!missing.validity.empty() && (missing.validity.size() * 64 < X.size()))
+    {
+      throw std::invalid_argument("MCL::linearRegression - Validity mask is shorter than the data.");
+    };
+
+    return pipeline(X)
+      .filter([&](std::size_t index, T x) { return detail::valid(missing, index, x) & detail::valid(missing, index, Y[index]); })
+      .regression([](T x) { return x; }, [&Y](std::size_t index, T) { return Y[index]; }, workspace);
+  }
+
+}  // namespace MCL
+
+#endif // MCL_STATISTICS_MISSING_HPP
@@ -0,0 +1,470 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								pipeline.hpp
+// SUBSYSTEM:						Statistics Functions.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Lazy filter/map/reduce pipelines over an array.
+//                        MCL::pipeline(data).filter([](double x) { return x > 0; })
+//                                           .map([](double x) { return std::log(x); }).stdev();
+//                      The filters and maps are composed into a single function of (index, value) that returns the mapped value
+//                      and whether the value is kept. Nothing is evaluated until a reduction (count, sum, mean, variance, stdev,
+//                      minmax, summary, coMoments, regression) is called. The reduction makes one pass over the source, spread
+//                      over the threads with parallelFor. Each thread evaluates chunks of PIPELINE_CHUNK values into arrays on
+//                      the stack, and reduces the chunk with masked (branch-free) loops that the compiler can vectorise. The
+//                      chunks are merged with the pairwise update used by summary_t. No temporary arrays are allocated. (The
+//                      per-thread results use the workspace.) Filters and maps are evaluated for every value, including values
+//                      rejected by an earlier filter (the result is then masked out), so they must be pure and must not throw.
+//                      Filters, maps and the coMoments()/regression() functions may take the value, or the index in the source
+//                      and the value.
+//
+// CLASSES INCLUDED:    pipeline_t
+//                      coMoments_t
+//
+// FUNCTIONS INCLUDED:  pipeline(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_STATISTICS_PIPELINE_HPP
+#define MCL_STATISTICS_PIPELINE_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <valarray>
+#include <vector>
+
+  // MCL Library header files
+
+#include "../config.h"
+#include "../utility/instrument.h"
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
+#include "summary.hpp"
+
+namespace MCL
+{
+  std::size_t constexpr PIPELINE_CHUNK = 256;         ///< Number of values evaluated before they are reduced.
+
+  /// @brief The co-moments of two series. (Used for the covariance, correlation and least squares regression.)
+
+  struct coMoments_t
+  {
+    FP_t count;
+    FP_t meanX;
+    FP_t meanY;
+    FP_t Cxx;                                         ///< Sum of the squared deviations of X.
+    FP_t Cyy;                                         ///< Sum of the squared deviations of Y.
+    FP_t Cxy;                                         ///< Sum of the products of the deviations.
+
+    /// @brief      Merges the co-moments of another part of the series. (Chan et al.)
+    /// @param[in]  other: The co-moments to merge.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    constexpr void merge(coMoments_t const &other) noexcept
+    {
+      if (other.count == 0)
+      {
+        return;
+      }
+      else if (count == 0)
+      {
+        *this = other;
+      }
+      else
+      {
+        FP_t n = count + other.count;
+        FP_t dx = other.meanX - meanX;
+        FP_t dy = other.meanY - meanY;
+        FP_t w = count * other.count / n;
+
+        meanX += dx * other.count / n;
+        meanY += dy * other.count / n;
+        Cxx += other.Cxx + dx * dx * w;
+        Cyy += other.Cyy + dy * dy * w;
+        Cxy += other.Cxy + dx * dy * w;
+        count = n;
+      };
+    }
+
+    constexpr FP_t slope() const noexcept { return Cxy / Cxx; }
+    constexpr FP_t intercept() const noexcept { return meanY - slope() * meanX; }
+    FP_t correlation() const noexcept { return Cxy / std::sqrt(Cxx * Cyy); }
+    constexpr FP_t covariance() const noexcept { return Cxy / (count - 1); }
+  };
+
+  namespace detail
+  {
+    /// @brief A value of a pipeline, and whether it has passed the filters.
+
+    template<typename V>
+    struct pipelineElement_t
+    {
+      V value;
+      bool keep;
+    };
+
+    /// @brief The result of a thread. (Trivial, so that it can be allocated from a workspace.)
+
+    struct pipelinePartial_t
+    {
+      std::uint64_t count;
+      FP_t sum;
+      FP_t M2;
+      FP_t min;
+      FP_t max;
+    };
+
+    /// @brief      Calls fn(index, value) if fn takes two arguments, otherwise fn(value).
+    /// @param[in]  fn: The function.
+    /// @param[in]  index: The index of the value in the source.
+    /// @param[in]  value: The value.
+    /// @returns    The result of the function.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename F, typename V>
+    decltype(auto) pipelineInvoke(F const &fn, std::size_t index, V const &value)
+    {
+      if constexpr (std::is_invocable_v<F const &, std::size_t, V const &>)
+      {
+        return fn(index, value);
+      }
+      else
+      {
+        return fn(value);
+      };
+    }
+  }
+
+  /// @brief A lazy pipeline over an array. Created with MCL::pipeline(...).
+
+  template<typename T, typename Op>
+  class pipeline_t
+  {
+  private:
+    std::span<T const> source;
+    Op op;                                            ///< op(index, value) returns a pipelineElement_t.
+
+    /// @brief      Evaluates the pipeline over [indexBegin; indexEnd) in chunks, and calls fn(count, keep, values...) for
+    ///             each chunk.
+    /// @param[in]  indexBegin: The first index.
+    /// @param[in]  indexEnd: One past the last index.
+    /// @param[in]  fn: Called with the chunk length, the keep flags and an array of values for each of the projections.
+    /// @param[in]  projections: Functions of (index, value) or (value), evaluated for each value.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename F, typename... P>
+    void forEachChunk(std::size_t indexBegin, std::size_t indexEnd, F &&fn, P const &... projections) const
+    {
+      bool keep[PIPELINE_CHUNK];
+      FP_t values[sizeof...(P)][PIPELINE_CHUNK];
+
+      for (std::size_t chunk = indexBegin; chunk < indexEnd; chunk += PIPELINE_CHUNK)
+      {
+        std::size_t length = std::min(PIPELINE_CHUNK, indexEnd - chunk);
+
+        for (std::size_t index = 0; index < length; index++)
+        {
+          auto element = op(chunk + index, source[chunk + index]);
+          std::size_t projection = 0;
+
+          keep[index] = element.keep;
+          ((values[projection++][index] = static_cast<FP_t>(detail::pipelineInvoke(projections, chunk + index,
+                                                                                    element.value))), ...);
+        };
+
+        fn(length, keep, values);
+      };
+    }
+
+  public:
+    using value_type = std::remove_cvref_t<decltype(std::declval<Op const &>()(std::size_t{}, std::declval<T const &>()).value)>;
+
+    constexpr pipeline_t(std::span<T const> data, Op operation) : source(data), op(std::move(operation)) {}
+
+    /// @brief      Adds a filter. Values for which the predicate returns false are not reduced.
+    /// @param[in]  predicate: Function of (value) or (index, value), returning true to keep the value.
+    /// @returns    The new pipeline.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename P>
+    auto filter(P predicate) const
+    {
+      auto composed = [op = op, predicate = std::move(predicate)](std::size_t index, T const &value)
+      {
+        auto element = op(index, value);
+
+        element.keep = element.keep & static_cast<bool>(detail::pipelineInvoke(predicate, index, element.value));
+        return element;
+      };
+
+      return pipeline_t<T, decltype(composed)>(source, std::move(composed));
+    }
+
+    /// @brief      Adds a map (transformation) of the values.
+    /// @param[in]  fn: Function of (value) or (index, value) returning the new value.
+    /// @returns    The new pipeline.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename F>
+    auto map(F fn) const
+    {
+      auto composed = [op = op, fn = std::move(fn)](std::size_t index, T const &value)
+      {
+        auto element = op(index, value);
+        using result_t = std::remove_cvref_t<decltype(detail::pipelineInvoke(fn, index, element.value))>;
+
+        return detail::pipelineElement_t<result_t>{ detail::pipelineInvoke(fn, index, element.value), element.keep };
+      };
+
+      return pipeline_t<T, decltype(composed)>(source, std::move(composed));
+    }
+
+    /// @brief      Reduces the pipeline to the count, sum, minimum, maximum, mean and variance of the kept values.
+    /// @param[in]  workspace: Scratch memory for the results of the threads.
+    /// @returns    The summary.
+    /// @throws     std::bad_alloc
+    /// @note       This function is multi-threaded.
+    /// @version    2026-10-19/GGB - Function created.
+
+    summary_t summary(workspace_t &workspace = workspace_t::local()) const
+    {
+      MCL_INSTRUMENT_KERNEL("pipeline.summary", source.size(), source.size() * sizeof(T));
+
+      summary_t result;
+
+      if (!source.empty())
+      {
+        workspace_t::scope_t scope(workspace);
+        std::span<detail::pipelinePartial_t> partials =
+          workspace.allocate<detail::pipelinePartial_t>(threadCount(source.size()));
+        auto identity = [](FP_t value) { return value; };
+
+        std::size_t numberOfThreads = parallelFor(source.size(), partials.size(),
+                                                  [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+        {
+          summary_t s;
+
+          forEachChunk(indexBegin, indexEnd, [&](std::size_t length, bool const *keep, FP_t const (*values)[PIPELINE_CHUNK])
+          {
+            FP_t const *v = values[0];
+            std::size_t count = 0;
+            FP_t sum = 0;
+
+            for (std::size_t index = 0; index < length; index++)
+            {
+              count += keep[index];
+              sum += keep[index] ? v[index] : 0;
+            };
+
+            if (count != 0)
+            {
+              FP_t mean = sum / static_cast<FP_t>(count);
+              FP_t M2 = 0;
+              FP_t min = std::numeric_limits<FP_t>::infinity();
+              FP_t max = -std::numeric_limits<FP_t>::infinity();
+
+              for (std::size_t index = 0; index < length; index++)
+              {
+                FP_t d = v[index] - mean;
+
+                M2 += keep[index] ? d * d : 0;
+                min = (keep[index] && (v[index] < min)) ? v[index] : min;
+                max = (keep[index] && (v[index] > max)) ? v[index] : max;
+              };
+
+              s.merge(summary_t(count, sum, M2, min, max));
+            };
+          }, identity);
+
+          partials[threadNumber] = detail::pipelinePartial_t{ s.count(), s.sum(), s.M2(), s.min(), s.max() };
+        });
+
+        MCL_INSTRUMENT_THREADS(numberOfThreads);
+
+        for (std::size_t index = 0; index < numberOfThreads; index++)
+        {
+          result.merge(summary_t(partials[index].count, partials[index].sum, partials[index].M2, partials[index].min,
+                                 partials[index].max));
+        };
+      };
+
+      return result;
+    }
+
+    /// @brief      Reduces the pipeline to the co-moments of two projections of the kept values.
+    /// @param[in]  fx: Function of (value) or (index, value) returning X.
+    /// @param[in]  fy: Function of (value) or (index, value) returning Y.
+    /// @param[in]  workspace: Scratch memory for the results of the threads.
+    /// @returns    The co-moments.
+    /// @throws     std::bad_alloc
+    /// @note       This function is multi-threaded.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename FX, typename FY>
+    coMoments_t coMoments(FX const &fx, FY const &fy, workspace_t &workspace = workspace_t::local()) const
+    {
+      MCL_INSTRUMENT_KERNEL("pipeline.coMoments", source.size(), source.size() * sizeof(T));
+
+      coMoments_t result{};
+
+      if (!source.empty())
+      {
+        workspace_t::scope_t scope(workspace);
+        std::span<coMoments_t> partials = workspace.allocate<coMoments_t>(threadCount(source.size()));
+
+        std::size_t numberOfThreads = parallelFor(source.size(), partials.size(),
+                                                  [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t threadNumber)
+        {
+          coMoments_t c{};
+
+          forEachChunk(indexBegin, indexEnd, [&](std::size_t length, bool const *keep, FP_t const (*values)[PIPELINE_CHUNK])
+          {
+            FP_t const *x = values[0];
+            FP_t const *y = values[1];
+            std::size_t count = 0;
+            FP_t sumX = 0, sumY = 0;
+
+            for (std::size_t index = 0; index < length; index++)
+            {
+              count += keep[index];
+              sumX += keep[index] ? x[index] : 0;
+              sumY += keep[index] ? y[index] : 0;
+            };
+
+            if (count != 0)
+            {
+              coMoments_t chunk{ static_cast<FP_t>(count), sumX / static_cast<FP_t>(count), sumY / static_cast<FP_t>(count),
+                                 0, 0, 0 };
+
+              for (std::size_t index = 0; index < length; index++)
+              {
+                FP_t dx = x[index] - chunk.meanX;
+                FP_t dy = y[index] - chunk.meanY;
+
+                chunk.Cxx += keep[index] ? dx * dx : 0;
+                chunk.Cyy += keep[index] ? dy * dy : 0;
+                chunk.Cxy += keep[index] ? dx * dy : 0;
+              };
+
+              c.merge(chunk);
+            };
+          }, fx, fy);
+
+          partials[threadNumber] = c;
+        });
+
+        MCL_INSTRUMENT_THREADS(numberOfThreads);
+
+        for (std::size_t index = 0; index < numberOfThreads; index++)
+        {
+          result.merge(partials[index]);
+        };
+      };
+
+      return result;
+    }
+
+    /// @brief      Least squares fit of Y = mX + c over two projections of the kept values.
+    /// @param[in]  fx: Function of (value) or (index, value) returning X.
+    /// @param[in]  fy: Function of (value) or (index, value) returning Y.
+    /// @param[in]  workspace: Scratch memory for the results of the threads.
+    /// @returns    The slope (first) and intercept (second). (m, C)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename FX, typename FY>
+    std::pair<FP_t, FP_t> regression(FX const &fx, FY const &fy, workspace_t &workspace = workspace_t::local()) const
+    {
+      coMoments_t c = coMoments(fx, fy, workspace);
+
+      return std::make_pair(c.slope(), c.intercept());
+    }
+
+    std::size_t count(workspace_t &workspace = workspace_t::local()) const { return summary(workspace).count(); }
+    FP_t sum(workspace_t &workspace = workspace_t::local()) const { return summary(workspace).sum(); }
+    std::optional<FP_t> mean(workspace_t &workspace = workspace_t::local()) const { return summary(workspace).mean(); }
+    std::optional<FP_t> variance(workspace_t &workspace = workspace_t::local()) const { return summary(workspace).variance(); }
+
+    /// @brief      Returns the sample standard deviation of the kept values.
+    /// @param[in]  workspace: Scratch memory for the results of the threads.
+    /// @returns    The standard deviation. No value if there are fewer than two values.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::optional<FP_t> stdev(workspace_t &workspace = workspace_t::local()) const
+    {
+      std::optional<FP_t> v = variance(workspace);
+
+      return v ? std::optional<FP_t>(std::sqrt(*v)) : std::optional<FP_t>();
+    }
+
+    /// @brief      Returns the minimum and maximum of the kept values.
+    /// @param[in]  workspace: Scratch memory for the results of the threads.
+    /// @returns    The minimum (first) and maximum (second). No value if no values are kept.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::optional<std::pair<FP_t, FP_t>> minmax(workspace_t &workspace = workspace_t::local()) const
+    {
+      summary_t s = summary(workspace);
+
+      return (s.count() == 0) ? std::optional<std::pair<FP_t, FP_t>>() : std::make_pair(s.min(), s.max());
+    }
+  };
+
+  /// @brief      Creates a pipeline over an array. The array must remain valid while the pipeline is used.
+  /// @param[in]  data: The values.
+  /// @returns    The pipeline.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  auto pipeline(std::span<T const> data)
+  {
+    auto identity = [](std::size_t, T const &value) { return detail::pipelineElement_t<T>{ value, true }; };
+
+    return pipeline_t<T, decltype(identity)>(data, identity);
+  }
+
+  template<typename T>
+  auto pipeline(T const *data, std::size_t count) { return pipeline(std::span<T const>(data, count)); }
+
+  template<typename T>
+  auto pipeline(std::vector<T> const &data) { return pipeline(std::span<T const>(data)); }
+
+  template<typename T>
+  auto pipeline(std::valarray<T> const &data) { return pipeline(std::span<T const>(std::begin(data), data.size())); }
+
+}  // namespace MCL
+
+#endif // MCL_STATISTICS_PIPELINE_HPP
@@ -0,0 +1,306 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								reproducible.hpp
+// SUBSYSTEM:						Statistics Functions.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Reproducible sum, mean and variance. The results of sum(), mean() and variance() depend on how the data
+//                      is split over the threads, so they change (in the last bits) with maxThreads. The _r functions give
+//                      the same result for any number of threads:
+//                        - The data is divided into blocks of REPRODUCIBLE_BLOCK values. The block boundaries depend only on
+//                          the position in the array.
+//                        - Each block is reduced with REPRODUCIBLE_LANES interleaved accumulators, that are added in a fixed
+//                          order. (The lanes also allow the compiler to vectorise the loop without re-association.)
+//                        - The block results are combined with a pairwise tree whose shape depends only on the number of
+//                          blocks.
+//                      The threads only decide which blocks they reduce, not the order of any operation. Changing the block
+//                      size or the number of lanes changes the results.
+//
+// FUNCTIONS INCLUDED:  sum_r(...)
+//                      mean_r(...)
+//                      variance_r(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_STATISTICS_REPRODUCIBLE_HPP
+#define MCL_STATISTICS_REPRODUCIBLE_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+  // MCL Library header files
+
+#include "../config.h"
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
+
+namespace MCL
+{
+  std::size_t constexpr REPRODUCIBLE_BLOCK = 4096;      ///< Number of values per block.
+  std::size_t constexpr REPRODUCIBLE_LANES = 8;         ///< Number of accumulators per block.
+
+  namespace detail
+  {
+    /// @brief Count, mean and sum of the squared deviations of a block (or of a number of blocks).
+
+    struct moments_t
+    {
+      FP_t count;
+      FP_t mean;
+      FP_t M2;
+    };
+
+    /// @brief      Adds the lanes in a fixed (pairwise) order.
+    /// @param[in]  lanes: The lane accumulators.
+    /// @returns    The sum of the lanes.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    inline FP_t laneSum(FP_t const (&lanes)[REPRODUCIBLE_LANES]) noexcept
+    {
+      return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+
+    /// @brief      Sums a block of values with interleaved accumulators.
+    /// @param[in]  data: The values.
+    /// @param[in]  count: The number of values. (At most REPRODUCIBLE_BLOCK.)
+    /// @returns    The sum.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    FP_t blockSum(T const *data, std::size_t count) noexcept
+    {
+      FP_t lanes[REPRODUCIBLE_LANES] = {};
+      std::size_t index = 0;
+
+      for (; index + REPRODUCIBLE_LANES <= count; index += REPRODUCIBLE_LANES)
+      {
+        for (std::size_t lane = 0; lane < REPRODUCIBLE_LANES; lane++)
+        {
+          lanes[lane] += static_cast<FP_t>(data[index + lane]);
+        };
+      };
+
+      for (std::size_t lane = 0; index + lane < count; lane++)
+      {
+        lanes[lane] += static_cast<FP_t>(data[index + lane]);
+      };
+
+      return laneSum(lanes);
+    }
+
+    /// @brief      Calculates the moments of a block of values. (Two passes: the mean, then the squared deviations.)
+    /// @param[in]  data: The values.
+    /// @param[in]  count: The number of values. (At most REPRODUCIBLE_BLOCK, more than zero.)
+    /// @returns    The moments.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    moments_t blockMoments(T const *data, std::size_t count) noexcept
+    {
+      FP_t mean = blockSum(data, count) / static_cast<FP_t>(count);
+      FP_t lanes[REPRODUCIBLE_LANES] = {};
+      std::size_t index = 0;
+
+      for (; index + REPRODUCIBLE_LANES <= count; index += REPRODUCIBLE_LANES)
+      {
+        for (std::size_t lane = 0; lane < REPRODUCIBLE_LANES; lane++)
+        {
+          FP_t d = static_cast<FP_t>(data[index + lane]) - mean;
+          lanes[lane] += d * d;
+        };
+      };
+
+      for (std::size_t lane = 0; index + lane < count; lane++)
+      {
+        FP_t d = static_cast<FP_t>(data[index + lane]) - mean;
+        lanes[lane] += d * d;
+      };
+
+      return moments_t{ static_cast<FP_t>(count), mean, laneSum(lanes) };
+    }
+
+    /// @brief      Combines the moments of two parts of a series. (Chan et al.)
+    /// @param[in]  a: The first part.
+    /// @param[in]  b: The second part.
+    /// @returns    The moments of the combined parts.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    inline moments_t combine(moments_t const &a, moments_t const &b) noexcept
+    {
+      FP_t count = a.count + b.count;
+      FP_t delta = b.mean - a.mean;
+
+      return moments_t{ count, a.mean + delta * (b.count / count), a.M2 + b.M2 + delta * delta * (a.count * b.count / count) };
+    }
+
+    /// @brief      Reduces an array of partial results with a pairwise tree. The shape of the tree depends only on the size of
+    ///             the array.
+    /// @param[in]  partials: The partial results. Overwritten.
+    /// @param[in]  fn: The function combining two partial results.
+    /// @returns    The reduced value.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T, typename F>
+    T pairwiseReduce(std::span<T> partials, F fn) noexcept
+    {
+      for (std::size_t stride = 1; stride < partials.size(); stride *= 2)
+      {
+        for (std::size_t index = 0; index + stride < partials.size(); index += 2 * stride)
+        {
+          partials[index] = fn(partials[index], partials[index + stride]);
+        };
+      };
+
+      return partials[0];
+    }
+
+    /// @brief      Calls fn(block) for each block of a series, spread over the threads.
+    /// @param[in]  count: The number of values.
+    /// @param[in]  fn: The function to call for each block.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename F>
+    void forEachBlock(std::size_t count, F fn)
+    {
+      std::size_t blocks = (count + REPRODUCIBLE_BLOCK - 1) / REPRODUCIBLE_BLOCK;
+
+      parallelFor(blocks, [&](std::size_t blockBegin, std::size_t blockEnd, std::size_t)
+      {
+        for (std::size_t block = blockBegin; block < blockEnd; block++)
+        {
+          fn(block);
+        };
+      }, 16);
+    }
+  }
+
+  /// @brief      Reproducible sum of an array. The result does not depend on the number of threads.
+  /// @param[in]  data: The values.
+  /// @param[in]  count: The number of values.
+  /// @param[in]  workspace: Scratch memory for the block results.
+  /// @returns    The sum. (Zero if there are no values.)
+  /// @throws     std::bad_alloc
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  FP_t sum_r(T const *data, std::size_t count, workspace_t &workspace = workspace_t::local())
+  {
+    MCL_INSTRUMENT_KERNEL("sum_r", count, count * sizeof(T));
+
+    if (count == 0)
+    {
+      return 0;
+    };
+
+    workspace_t::scope_t scope(workspace);
+    std::span<FP_t> sums = workspace.allocate<FP_t>((count + REPRODUCIBLE_BLOCK - 1) / REPRODUCIBLE_BLOCK);
+
+    detail::forEachBlock(count, [&](std::size_t block)
+    {
+      std::size_t first = block * REPRODUCIBLE_BLOCK;
+
+      sums[block] = detail::blockSum(data + first, std::min(REPRODUCIBLE_BLOCK, count - first));
+    });
+
+    return detail::pairwiseReduce(sums, [](FP_t a, FP_t b) { return a + b; });
+  }
+
+  /// @brief      Reproducible mean of an array. The result does not depend on the number of threads.
+  /// @param[in]  data: The values.
+  /// @param[in]  count: The number of values.
+  /// @param[in]  workspace: Scratch memory for the block results.
+  /// @returns    The mean. No value if there are no values.
+  /// @throws     std::bad_alloc
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<FP_t> mean_r(T const *data, std::size_t count, workspace_t &workspace = workspace_t::local())
+  {
+    MCL_INSTRUMENT_KERNEL("mean_r", count, count * sizeof(T));
+
+    if (count == 0)
+    {
+      return std::optional<FP_t>();
+    }
+    else
+    {
+      return std::optional<FP_t>(sum_r(data, count, workspace) / static_cast<FP_t>(count));
+    };
+  }
+
+  /// @brief      Reproducible sample variance of an array. The result does not depend on the number of threads.
+  /// @param[in]  data: The values.
+  /// @param[in]  count: The number of values.
+  /// @param[in]  workspace: Scratch memory for the block results.
+  /// @returns    The variance. (M2 / (n - 1)) No value if there are no values, zero if there is one value.
+  /// @throws     std::bad_alloc
+  /// @note       This function is multi-threaded.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename T>
+  std::optional<FP_t> variance_r(T const *data, std::size_t count, workspace_t &workspace = workspace_t::local())
+  {
+    MCL_INSTRUMENT_KERNEL("variance_r", count, count * sizeof(T));
+
+    if (count == 0)
+    {
+      return std::optional<FP_t>();
+    }
+    else if (count == 1)
+    {
+      return std::optional<FP_t>(0);
+    };
+
+    workspace_t::scope_t scope(workspace);
+    std::span<detail::moments_t> moments =
+      workspace.allocate<detail::moments_t>((count + REPRODUCIBLE_BLOCK - 1) / REPRODUCIBLE_BLOCK);
+
+    detail::forEachBlock(count, [&](std::size_t block)
+    {
+      std::size_t first = block * REPRODUCIBLE_BLOCK;
+
+      moments[block] = detail::blockMoments(data + first, std::min(REPRODUCIBLE_BLOCK, count - first));
+    });
+
+    detail::moments_t result = detail::pairwiseReduce(moments, detail::combine);
+
+    return std::optional<FP_t>(result.M2 / (result.count - 1));
+  }
+
+}  // namespace MCL
+
+#endif // MCL_STATISTICS_REPRODUCIBLE_HPP
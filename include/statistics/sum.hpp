@@ -5,7 +5,7 @@
 // SUBSYSTEM:						Statistics Functions.
 // LANGUAGE:						C++
 // TARGET OS:						WINDOWS/UNIX/LINUX/MAC
-// LIBRARY DEPENDANCE:	boost
+// LIBRARY DEPENDANCE:	None.
 // NAMESPACE:						MCL
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
@@ -31,7 +31,9 @@
 // FUNCTIONS INCLUDED:  sum(...)  - Sums the elements of a valarray
 //
 //
-// HISTORY:             2018-09-20 GGB - Refactoring to use std::uniqu_ptr
+// HISTORY:             2026-10-19 GGB - Exact accumulation for integral types.
+//                      2026-10-19 GGB - Temporary arrays allocated from a workspace_t.
+//                      2018-09-20 GGB - Refactoring to use std::uniqu_ptr
 //                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2014-01-13/GGB - Development of function
 //
@@ -43,19 +45,15 @@
   // Standard C++ library header files.
 
 #include <cstdint>
-#include <memory>
+#include <span>
 #include <valarray>
 
   // MCL Library
 
 #include "../config.h"
-
-#ifndef MCL_NOBOOST
-  // Boost Library
-#ifndef MCL_NOMT
-#include "boost/thread/thread.hpp"
-#endif // MCL_NOMT
-#endif // MCL_NOBOOST
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
+#include "integral.hpp"
 
 
 namespace MCL
@@ -67,11 +65,19 @@ namespace MCL
   /// @param[in] data - The array to sum.
   /// @returns The sum of the data.
   /// @throws None
+  /// @version 2026-10-19/GGB - Exact accumulation for integral types.
   /// @version 2016-01-15/GGB - Function created.
 
   template<typename T>
-  FP_t sum(std::valarray<T> &data)
+  FP_t sum(std::valarray<T> &data, workspace_t & = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("sum", data.size(), data.size() * sizeof(T));
+
+    if constexpr (detail::exactIntegral_v<T>)
+    {
+      return static_cast<FP_t>(detail::integralSum(std::begin(data), data.size()));
+    };
+
     size_t index;
     FP_t returnValue = 0;
 
@@ -103,60 +109,36 @@ namespace MCL
 
   /// @brief      Determines the sum of the array
   /// @param[in]  data: A valarray to sum.
-  /// @throws
+  /// @param[in]  workspace: Scratch memory for the partial results of the threads.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Exact accumulation for integral types.
+  /// @version    2026-10-19/GGB - Use a workspace for the partial results.
   /// @version    2014-01-13/GGB - Function created.
 
   template<typename T>
-  FP_t sum(std::valarray<T> &data)
+  FP_t sum(std::valarray<T> &data, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("sum", data.size(), data.size() * sizeof(T));
+
+    if constexpr (detail::exactIntegral_v<T>)
+    {
+      return static_cast<FP_t>(detail::integralSum(std::begin(data), data.size(), workspace));
+    };
+
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    boost::thread_group threadGroup;
-    boost::thread *thread;
-    size_t indexBegin = 0, indexEnd = 0;
     size_t index;
     FP_t returnValue = 0;
     size_t count = data.size();
 
     if (count != 0)
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values
+      workspace_t::scope_t scope(workspace);
+      std::span<FP_t> sums = workspace.allocate<FP_t>(threadCount(count));
 
-      numberOfThreads = count / 1000;
-      if (numberOfThreads == 0)
+      numberOfThreads = parallelFor(count, sums.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        numberOfThreads = 1;
-      }
-      else if (numberOfThreads > maxThreads)
-      {
-        numberOfThreads = maxThreads;
-      };
-
-      stepSize = count / numberOfThreads;
-
-      std::unique_ptr<FP_t []> sums(new FP_t[numberOfThreads]);
-
-        // Spawn the threads.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
-      {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads - 1) )
-        {
-          indexEnd = count;
-        }
-        else
-        {
-          indexEnd += stepSize;
-        };
-
-        thread = new boost::thread(&sumThread<T>, boost::cref(data), indexBegin, indexEnd, boost::ref(sums[threadNumber]));
-        threadGroup.add_thread(thread);
-        thread = nullptr;
-      };
-
-      threadGroup.join_all();     // Wait for all the threads to finish.
+        sumThread<T>(data, indexBegin, indexEnd, sums[threadNumber]);
+      });
 
       for(index = 0; index < numberOfThreads; index++)
       {
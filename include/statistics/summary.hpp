@@ -0,0 +1,194 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								summary.hpp
+// SUBSYSTEM:						Statistics Functions.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A streaming accumulator for the count, sum, minimum, maximum, mean and variance of a series.
+//                      Values are added singly or in blocks, and accumulators for separate parts of a series are merged with
+//                      the pairwise update of Chan et al. (the same update the multi-threaded variance function uses to combine
+//                      the results of its threads).
+//
+// CLASSES INCLUDED:    summary_t
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_STATISTICS_SUMMARY_HPP
+#define MCL_STATISTICS_SUMMARY_HPP
+
+  // Standard C++ library header files
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+
+  // MCL Library header files
+
+#include "../config.h"
+
+namespace MCL
+{
+  class summary_t
+  {
+  private:
+    std::uint64_t count_ = 0;
+    FP_t sum_ = 0;
+    FP_t mean_ = 0;
+    FP_t M2_ = 0;                                                   ///< Sum of the squared deviations from the mean.
+    FP_t min_ = std::numeric_limits<FP_t>::infinity();
+    FP_t max_ = -std::numeric_limits<FP_t>::infinity();
+
+  protected:
+  public:
+    constexpr summary_t() noexcept = default;
+
+    /// @brief      Constructs a summary from stored values. (For example the footer of a column file.)
+    /// @param[in]  count: The number of values.
+    /// @param[in]  sum: The sum of the values.
+    /// @param[in]  M2: The sum of the squared deviations from the mean.
+    /// @param[in]  min: The minimum value.
+    /// @param[in]  max: The maximum value.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    constexpr summary_t(std::uint64_t count, FP_t sum, FP_t M2, FP_t min, FP_t max) noexcept
+      : count_(count), sum_(sum), mean_(count == 0 ? 0 : sum / static_cast<FP_t>(count)), M2_(M2), min_(min), max_(max) {}
+
+    /// @brief      Adds a value.
+    /// @param[in]  value: The value to add.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    constexpr void add(FP_t value) noexcept
+    {
+      FP_t delta = value - mean_;
+
+      count_++;
+      sum_ += value;
+      mean_ += delta / static_cast<FP_t>(count_);
+      M2_ += delta * (value - mean_);
+      min_ = (value < min_) ? value : min_;
+      max_ = (value > max_) ? value : max_;
+    }
+
+    /// @brief      Adds a block of values. The block is summarised with two passes (mean, then the squared deviations)
+    ///             and merged.
+    /// @param[in]  values: The values to add.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    void add(std::span<T const> values) noexcept
+    {
+      if (!values.empty())
+      {
+        FP_t blockSum = 0;
+        FP_t blockMin = static_cast<FP_t>(values[0]);
+        FP_t blockMax = blockMin;
+
+        for (T value : values)
+        {
+          FP_t v = static_cast<FP_t>(value);
+
+          blockSum += v;
+          blockMin = (v < blockMin) ? v : blockMin;
+          blockMax = (v > blockMax) ? v : blockMax;
+        };
+
+        FP_t blockMean = blockSum / static_cast<FP_t>(values.size());
+        FP_t blockM2 = 0;
+
+        for (T value : values)
+        {
+          FP_t d = static_cast<FP_t>(value) - blockMean;
+          blockM2 += d * d;
+        };
+
+        merge(summary_t(values.size(), blockSum, blockM2, blockMin, blockMax));
+      };
+    }
+
+    /// @brief      Merges the summary of another part of the series.
+    /// @param[in]  other: The summary to merge.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    constexpr void merge(summary_t const &other) noexcept
+    {
+      if (other.count_ == 0)
+      {
+        return;
+      }
+      else if (count_ == 0)
+      {
+        *this = other;
+      }
+      else
+      {
+        FP_t n1 = static_cast<FP_t>(count_);
+        FP_t n2 = static_cast<FP_t>(other.count_);
+        FP_t delta = other.mean_ - mean_;
+
+        count_ += other.count_;
+        sum_ += other.sum_;
+        M2_ += other.M2_ + delta * delta * n1 * n2 / (n1 + n2);
+        mean_ += delta * n2 / (n1 + n2);
+        min_ = (other.min_ < min_) ? other.min_ : min_;
+        max_ = (other.max_ > max_) ? other.max_ : max_;
+      };
+    }
+
+    constexpr std::uint64_t count() const noexcept { return count_; }
+    constexpr FP_t sum() const noexcept { return sum_; }
+    constexpr FP_t M2() const noexcept { return M2_; }
+    constexpr FP_t min() const noexcept { return min_; }
+    constexpr FP_t max() const noexcept { return max_; }
+
+    /// @brief      Returns the mean of the values.
+    /// @returns    The mean. No value if the summary is empty.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    constexpr std::optional<FP_t> mean() const noexcept
+    {
+      return (count_ == 0) ? std::optional<FP_t>() : std::optional<FP_t>(mean_);
+    }
+
+    /// @brief      Returns the sample variance of the values. (M2 / (n - 1))
+    /// @returns    The variance. No value if there are fewer than two values.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    constexpr std::optional<FP_t> variance() const noexcept
+    {
+      return (count_ < 2) ? std::optional<FP_t>() : std::optional<FP_t>(M2_ / static_cast<FP_t>(count_ - 1));
+    }
+  };
+
+}  // namespace MCL
+
+#endif // MCL_STATISTICS_SUMMARY_HPP
@@ -5,7 +5,7 @@
 // SUBSYSTEM:						Statistics Functions - Variance
 // LANGUAGE:						C++
 // TARGET OS:						WINDOWS/UNIX/LINUX/MAC
-// LIBRARY DEPENDANCE:	boost
+// LIBRARY DEPENDANCE:	None.
 // NAMESPACE:						MCL
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
@@ -31,7 +31,9 @@
 // FUNCTIONS INCLUDED:  variance(...)
 //
 //
-// HISTORY:             2018-09-20 GGB - Refactoring to use std::uniqu_ptr
+// HISTORY:             2026-10-19 GGB - Exact accumulation for integral types.
+//                      2026-10-19 GGB - Temporary arrays allocated from a workspace_t.
+//                      2018-09-20 GGB - Refactoring to use std::uniqu_ptr
 //                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2013-09-30 GGB - astroManager 2013.09 release.
 //                      2013-08-02/GGB - Updated to be 64bit compliant.
@@ -46,9 +48,8 @@
   // Standard C++ library header files
 
 #include <cstdint>
-#include <memory>
 #include <optional>
-#include <thread>
+#include <span>
 #include <valarray>
 #include <vector>
 
@@ -56,14 +57,9 @@
 
 #include "../config.h"
 #include "../functions.hpp"
-
-  // Boost Library
-
-#ifndef MCL_NOBOOST
-#ifndef MCL_NOMT
-#include "boost/thread/thread.hpp"
-#endif // MCL_NOMT
-#endif // MCL_NOBOOST
+#include "../utility/parallel.hpp"
+#include "../utility/workspace.hpp"
+#include "integral.hpp"
 
 namespace MCL
 {
@@ -153,23 +149,48 @@ namespace MCL
     };
   }
 
+  /// @brief Combines the partial results of the threads.
+  /// @param[in] means: The means of the blocks.
+  /// @param[in] M2s: The sum of the squared deviations of the blocks.
+  /// @param[in] counts: The number of values in the blocks.
+  /// @returns The variance.
+  /// @throws None.
+  /// @version 2026-10-19/GGB - Function created. (Extracted from variance(...))
+
+  inline FP_t varianceMerge(std::span<FP_t const> means, std::span<FP_t const> M2s, std::span<size_t const> counts) noexcept
+  {
+    FP_t count = counts[0];
+    FP_t delta = 0;
+    FP_t mean = means[0];
+    FP_t M2 = M2s[0];
+
+    for(size_t index = 1; index < counts.size(); index++)
+    {
+      delta = means[index] - mean;
+      mean = (count * mean + counts[index] * means[index]) / (count + counts[index]);
+      M2 = M2 + M2s[index] + pow2(delta) * count * counts[index] / (count + counts[index]);
+      count += counts[index];
+    };
+
+    return M2 / (count - 1);
+  }
+
   /// @brief Multi-threaded function to calculate the variance
   /// @param[in] data: Pointer to the data.
   /// @param[in] dataCount: The number of data points.
-  /// @throws
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
+  /// @throws std::bad_alloc
+  /// @version 2026-10-19/GGB - Exact accumulation for integral types.
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results.
   /// @version 2018-09-20/GGB - Updated to use std::unique_ptr instead of boost scoped arrays.
   /// @version 2015-08-30/GGB - Function created.
 
   template<typename T>
-  std::optional<FP_t> variance(T *data, size_t dataCount)
+  std::optional<FP_t> variance(T *data, size_t dataCount, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("variance", dataCount, dataCount * sizeof(T));
+
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    boost::thread_group threadGroup;
-    boost::thread *thread;
-    size_t indexBegin, indexEnd = 0;
-    size_t index;
 
     if (dataCount == 0)
     {
@@ -181,165 +202,74 @@ namespace MCL
     }
     else
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values
-
-      numberOfThreads = dataCount / 1000;
-      if (numberOfThreads == 0)
-      {
-        numberOfThreads = 1;
-      }
-      else if (numberOfThreads > maxThreads)
-      {
-        numberOfThreads = maxThreads;
-      }
-
-      stepSize = dataCount / numberOfThreads;
-
-      std::unique_ptr<size_t []> counts(new size_t[numberOfThreads]);
-      std::unique_ptr<FP_t []> means(new FP_t[numberOfThreads]);
-      std::unique_ptr<FP_t []> M2s(new FP_t[numberOfThreads]);
-
-        // Spawn the threads to calculate the variance of each thread.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
+      if constexpr (detail::exactIntegral_v<T>)
       {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads -1) )
-        {
-          indexEnd = dataCount;
-        }
-        else
+        if (std::optional<FP_t> v = detail::integralVariance(detail::integralMoments(data, dataCount, workspace)))
         {
-          indexEnd += stepSize;
+          return v;
         };
-
-        thread = new boost::thread(&varianceThread<T>, boost::cref(data), indexBegin, indexEnd,
-                                   boost::ref(means[threadNumber]), boost::ref(M2s[threadNumber]),
-                                   boost::ref(counts[threadNumber]));
-        threadGroup.add_thread(thread);
-        thread = nullptr;
       };
 
-      threadGroup.join_all();     // Wait for all the threads to finish.
+      workspace_t::scope_t scope(workspace);
+      std::span<size_t> counts = workspace.allocate<size_t>(threadCount(dataCount));
+      std::span<FP_t> means = workspace.allocate<FP_t>(counts.size());
+      std::span<FP_t> M2s = workspace.allocate<FP_t>(counts.size());
 
-        // Now calculate the variance from the variances.
-
-      FP_t count = 0;
-      FP_t variance = 0;
-      FP_t delta = 0;
-      FP_t mean = 0;
-      FP_t M2;
+        // Calculate the variance of each block.
 
-      if (numberOfThreads == 1)
-      {
-        variance = M2s[0] / (counts[0] - 1);
-      }
-      else
+      numberOfThreads = parallelFor(dataCount, counts.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        M2 = M2s[0];
-        mean = means[0];
-        count = counts[0];
+        varianceThread<T>(data, indexBegin, indexEnd, means[threadNumber], M2s[threadNumber], counts[threadNumber]);
+      });
 
-        for(index = 1; index < numberOfThreads; index++)
-        {
-          delta = means[index] - mean;
-          mean = (count * mean + counts[index] * means[index]) / (count + counts[index]);
-          M2 = M2 + M2s[index] + pow2(delta) * count * counts[index] / (count + counts[index]);
-          count += counts[index];
-        };
-
-        variance = M2 / (count - 1);
-      };
+        // Now calculate the variance from the variances.
 
-      return std::optional<FP_t>(variance);
+      return std::optional<FP_t>(varianceMerge(means.first(numberOfThreads), M2s.first(numberOfThreads),
+                                               counts.first(numberOfThreads)));
     };
   }
 
   /// @brief Multi-threaded function to calculate the variance of a valarray
   /// @param[in] data: The valarray
-  /// @throws
+  /// @param[in] workspace: Scratch memory for the partial results of the threads.
+  /// @throws std::bad_alloc
+  /// @version 2026-10-19/GGB - Exact accumulation for integral types.
+  /// @version 2026-10-19/GGB - Use a workspace for the partial results.
   /// @version 2022-11-29/GGB - Function created.
 
   template<typename T>
-  FP_t variance(std::valarray<T> const &va)
+  FP_t variance(std::valarray<T> const &va, workspace_t &workspace = workspace_t::local())
   {
+    MCL_INSTRUMENT_KERNEL("variance", va.size(), va.size() * sizeof(T));
+
     FP_t rv = 0;
     size_t numberOfThreads;
-    size_t threadNumber;
-    size_t stepSize;
-    std::vector<std::thread *> threadGroup;
-    std::thread *thread;
-    size_t indexBegin, indexEnd = 0;
-    size_t index;
 
     if (va.size() > 1)
     {
-       // Ensure that we are using a reasonable number of threads. Maximise the number of threads to the number of values
-
-      numberOfThreads = std::min(std::max(size_t {1}, va.size() / 1000), maxThreads);
-
-      stepSize = va.size() / numberOfThreads;
-
-      std::unique_ptr<size_t []> counts(new size_t[numberOfThreads]);
-      std::unique_ptr<FP_t []> means(new FP_t[numberOfThreads]);
-      std::unique_ptr<FP_t []> M2s(new FP_t[numberOfThreads]);
-
-        // Spawn the threads to calculate the variance of each thread.
-
-      for (threadNumber = 0; threadNumber < numberOfThreads; threadNumber++)
+      if constexpr (detail::exactIntegral_v<T>)
       {
-        indexBegin = indexEnd;
-        if (threadNumber == (numberOfThreads - 1) )
+        if (std::optional<FP_t> v = detail::integralVariance(detail::integralMoments(std::begin(va), va.size(), workspace)))
         {
-          indexEnd = va.size();
-        }
-        else
-        {
-          indexEnd += stepSize;
+          return *v;
         };
-
-        thread = new std::thread(&varianceThreadVA<T>, std::cref(va), indexBegin, indexEnd,
-                                   std::ref(means[threadNumber]), std::ref(M2s[threadNumber]),
-                                   std::ref(counts[threadNumber]));
-        threadGroup.push_back(thread);
-        thread = nullptr;
       };
 
-      for (auto &thread : threadGroup)
-      {
-        thread->join();
-      }
-
-        // Now calculate the variance from the variances.
+      workspace_t::scope_t scope(workspace);
+      std::span<size_t> counts = workspace.allocate<size_t>(threadCount(va.size()));
+      std::span<FP_t> means = workspace.allocate<FP_t>(counts.size());
+      std::span<FP_t> M2s = workspace.allocate<FP_t>(counts.size());
 
-      FP_t count = 0;
-      FP_t variance = 0;
-      FP_t delta = 0;
-      FP_t mean = 0;
-      FP_t M2;
+        // Calculate the variance of each block.
 
-      if (numberOfThreads == 1)
-      {
-        variance = M2s[0] / (counts[0] - 1);
-      }
-      else
+      numberOfThreads = parallelFor(va.size(), counts.size(), [&](size_t indexBegin, size_t indexEnd, size_t threadNumber)
       {
-        M2 = M2s[0];
-        mean = means[0];
-        count = counts[0];
+        varianceThreadVA<T>(va, indexBegin, indexEnd, means[threadNumber], M2s[threadNumber], counts[threadNumber]);
+      });
 
-        for(index = 1; index < numberOfThreads; index++)
-        {
-          delta = means[index] - mean;
-          mean = (count * mean + counts[index] * means[index]) / (count + counts[index]);
-          M2 = M2 + M2s[index] + pow2(delta) * count * counts[index] / (count + counts[index]);
-          count += counts[index];
-        };
-
-        variance = M2 / (count - 1);
-      };
+        // Now calculate the variance from the variances.
 
-      rv = variance;
+      rv = varianceMerge(means.first(numberOfThreads), M2s.first(numberOfThreads), counts.first(numberOfThreads));
     };
 
     return rv;
@@ -0,0 +1,111 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								async.hpp
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Asynchronous calls of the library functions.
+//                      async(options, fn) runs fn on an executor (executor_t::global() by default) and returns a std::future for the result.
+//                      An exception thrown by fn is rethrown by future::get(). The task runs in the execution context of the calling
+//                      thread, with a cancellation_t built from the stop token and the deadline in the options installed. A task whose
+//                      stop has been requested, or whose deadline has passed, before it starts is abandoned without being run.
+//                      The heavy functions have overloads that take asyncOptions_t as the first parameter. These take their data by value
+//                      so that the caller does not need to keep the data alive until the future is ready.
+//
+// CLASSES INCLUDED:    asyncOptions_t
+//
+// FUNCTIONS INCLUDED:  async(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_UTILITY_ASYNC_HPP
+#define MCL_UTILITY_ASYNC_HPP
+
+  // Standard C++ library header files
+
+#include <future>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+
+  // MCL library header files.
+
+#include "cancellation.h"
+#include "executionContext.h"
+#include "executor.h"
+
+namespace MCL
+{
+  /// @brief Options of an asynchronous call.
+
+  struct asyncOptions_t
+  {
+    std::stop_token stopToken{};                                      ///< Request a stop on the source to cancel the call.
+    std::optional<cancellation_t::clock_t::time_point> deadline{};    ///< The call fails with deadline_exceeded after this.
+    executor_t *executor = nullptr;                                   ///< nullptr to use executor_t::global().
+  };
+
+  /// @brief      Runs a function on an executor.
+  /// @param[in]  options: The stop token, deadline and executor for the call.
+  /// @param[in]  fn: The function to run. Called with no arguments.
+  /// @returns    A future for the result of the function. If the call is cancelled the future holds
+  ///             MCL::operation_cancelled or MCL::deadline_exceeded.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename F>
+  std::future<std::invoke_result_t<std::decay_t<F> &>> async(asyncOptions_t const &options, F &&fn)
+  {
+    using result_t = std::invoke_result_t<std::decay_t<F> &>;
+
+    std::optional<executionContext_t> context;
+
+    if (executionContext_t const *current = executionContext_t::current())
+    {
+      context = *current;
+    };
+
+    auto task = std::make_shared<std::packaged_task<result_t()>>(
+      [fn = std::forward<F>(fn), cancellation = cancellation_t(options.stopToken, options.deadline),
+       context = std::move(context)]() mutable -> result_t
+    {
+      executionContext_t::scope_t contextScope(context ? &*context : nullptr);
+      cancellation_t::scope_t cancellationScope(cancellation);
+
+      cancellation.check();
+      return fn();
+    });
+    std::future<result_t> future = task->get_future();
+
+    (options.executor ? *options.executor : executor_t::global()).post([task]() { (*task)(); });
+
+    return future;
+  }
+
+}   // namespace MCL
+
+#endif // MCL_UTILITY_ASYNC_HPP
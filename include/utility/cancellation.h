@@ -0,0 +1,114 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								cancellation
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Cooperative cancellation of the long-running functions.
+//                      A cancellation_t combines a std::stop_token and an optional deadline. It is installed for the calling thread with a
+//                      scope_t, and the long-running functions (XIRR, median, anderson_darling_1S) call cancellationPoint() between their
+//                      phases. A cancellation point throws operation_cancelled if a stop has been requested, or deadline_exceeded if the
+//                      deadline has passed. Without an installed cancellation a cancellation point does nothing.
+//                      Only the thread that installed the cancellation is interrupted. Worker threads started by parallelFor always run
+//                      their block to completion.
+//
+// CLASSES INCLUDED:    cancellation_t
+//
+// FUNCTIONS INCLUDED:  cancellationPoint()
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_UTILITY_CANCELLATION_H
+#define MCL_UTILITY_CANCELLATION_H
+
+  // Standard C++ library header files
+
+#include <chrono>
+#include <optional>
+#include <stop_token>
+#include <utility>
+
+namespace MCL
+{
+  class cancellation_t
+  {
+  public:
+    using clock_t = std::chrono::steady_clock;
+
+  private:
+    std::stop_token token_;
+    std::optional<clock_t::time_point> deadline_;
+
+  protected:
+  public:
+    /// @brief Installs a cancellation for the calling thread. The previous cancellation is restored when the scope is
+    ///        destroyed.
+
+    class scope_t
+    {
+    private:
+      cancellation_t const *previous;
+
+    public:
+      explicit scope_t(cancellation_t const *) noexcept;
+      explicit scope_t(cancellation_t const &cancellation) noexcept : scope_t(&cancellation) {}
+      scope_t(scope_t const &) = delete;
+      scope_t &operator=(scope_t const &) = delete;
+      ~scope_t();
+    };
+
+    cancellation_t() = default;
+    explicit cancellation_t(std::stop_token token, std::optional<clock_t::time_point> deadline = std::nullopt) noexcept
+      : token_(std::move(token)), deadline_(deadline) {}
+    cancellation_t(std::stop_token token, clock_t::duration budget) noexcept
+      : token_(std::move(token)), deadline_(clock_t::now() + budget) {}
+
+    std::stop_token const &token() const noexcept { return token_; }
+    std::optional<clock_t::time_point> const &deadline() const noexcept { return deadline_; }
+
+    bool stopRequested() const noexcept { return token_.stop_requested(); }
+    bool expired() const noexcept { return deadline_ && (clock_t::now() >= *deadline_); }
+
+    void check() const;
+
+    static cancellation_t const *current() noexcept;
+  };
+
+  /// @brief      Checks the cancellation installed for the calling thread.
+  /// @throws     MCL::operation_cancelled
+  /// @throws     MCL::deadline_exceeded
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline void cancellationPoint()
+  {
+    if (cancellation_t const *cancellation = cancellation_t::current())
+    {
+      cancellation->check();
+    };
+  }
+
+}   // namespace MCL
+
+#endif // MCL_UTILITY_CANCELLATION_H
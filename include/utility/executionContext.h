@@ -0,0 +1,104 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								executionContext
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            The threading budget of the multi-threaded functions.
+//                      availableConcurrency() is the number of CPUs the process may use: the smaller of the hardware
+//                      concurrency, the CPU affinity mask and the cgroup (v1 or v2) CPU quota. It is the default of
+//                      MCL::maxThreads.
+//                      An executionContext_t caps the number of threads and optionally pins the worker threads to a list of
+//                      CPUs. A context is installed for the calling thread with a scope_t, and applies to all the functions
+//                      called in the scope. Without a context the functions use MCL::maxThreads. Worker threads started by
+//                      parallelFor run in the context of the thread that started them.
+//
+// CLASSES INCLUDED:    executionContext_t
+//
+// FUNCTIONS INCLUDED:  availableConcurrency()
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_UTILITY_EXECUTIONCONTEXT_H
+#define MCL_UTILITY_EXECUTIONCONTEXT_H
+
+  // Standard C++ library header files
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace MCL
+{
+  std::size_t availableConcurrency() noexcept;
+
+  namespace detail
+  {
+    std::optional<std::size_t> cgroupV2Limit(std::string_view) noexcept;
+    std::optional<std::size_t> cgroupV1Limit(long long, long long) noexcept;
+  }
+
+  class executionContext_t
+  {
+  private:
+    std::size_t maxThreads_;
+    std::vector<int> cpus_;                 ///< CPUs to pin the worker threads to. Empty if the threads are not pinned.
+
+  protected:
+  public:
+    /// @brief Installs a context for the calling thread. The previous context is restored when the scope is destroyed.
+
+    class scope_t
+    {
+    private:
+      executionContext_t const *previous;
+
+    public:
+      explicit scope_t(executionContext_t const *) noexcept;
+      explicit scope_t(executionContext_t const &context) noexcept : scope_t(&context) {}
+      scope_t(scope_t const &) = delete;
+      scope_t &operator=(scope_t const &) = delete;
+      ~scope_t();
+    };
+
+    executionContext_t();
+    explicit executionContext_t(std::size_t, std::vector<int> = {});
+
+    std::size_t maxThreads() const noexcept { return maxThreads_; }
+    void maxThreads(std::size_t threads) noexcept { maxThreads_ = (threads == 0) ? 1 : threads; }
+
+    std::vector<int> const &cpus() const noexcept { return cpus_; }
+    void pin(std::vector<int> cpus) { cpus_ = std::move(cpus); }
+
+    void enter(std::size_t) const noexcept;
+
+    static executionContext_t const *current() noexcept;
+  };
+
+}   // namespace MCL
+
+#endif // MCL_UTILITY_EXECUTIONCONTEXT_H
@@ -0,0 +1,82 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								executor
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A fixed pool of worker threads that runs the asynchronous functions. (See async.hpp)
+//                      Tasks are run in the order they are posted. The pool is created with availableConcurrency() threads unless a size is
+//                      given. executor_t::global() is the pool used when no executor is specified. It is created on first use.
+//                      The destructor runs the tasks that are already queued, then joins the threads.
+//
+// CLASSES INCLUDED:    executor_t
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_UTILITY_EXECUTOR_H
+#define MCL_UTILITY_EXECUTOR_H
+
+  // Standard C++ library header files
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MCL
+{
+  class executor_t
+  {
+  private:
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::function<void()>> queue;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+
+    void run();
+    void stop() noexcept;
+
+  protected:
+  public:
+    executor_t();
+    explicit executor_t(std::size_t);
+    executor_t(executor_t const &) = delete;
+    executor_t &operator=(executor_t const &) = delete;
+    ~executor_t();
+
+    void post(std::function<void()>);
+
+    std::size_t size() const noexcept { return workers.size(); }
+
+    static executor_t &global();
+  };
+
+}   // namespace MCL
+
+#endif // MCL_UTILITY_EXECUTOR_H
@@ -0,0 +1,166 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								instrument
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL::instrument
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Instrumentation of the library functions. When MCL_INSTRUMENTATION is defined, the functions record the
+//                      number of calls, the number of elements, the bytes read, the threads used and the wall time for each
+//                      function (kernel), and for the phases of parallelFor (starting the threads, and waiting for them).
+//                      When MCL_INSTRUMENTATION is not defined the MCL_INSTRUMENT_... macros expand to nothing.
+//                      The counters are held per thread and are only written by the owning thread (relaxed atomics), so
+//                      recording does not take a lock. snapshot() sums the counters of all the threads.
+//                      If tracing is enabled, each scope is also stored as an event and can be exported in the Chrome trace
+//                      format (chrome://tracing, Perfetto). A callback can be registered to receive each event as it
+//                      completes.
+//
+// CLASSES INCLUDED:    scope_t
+//
+// FUNCTIONS INCLUDED:  registerKernel(...)
+//                      snapshot()
+//                      reset()
+//                      toJSON()
+//                      toChromeTrace()
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_UTILITY_INSTRUMENT_H
+#define MCL_UTILITY_INSTRUMENT_H
+
+  // Standard C++ library header files
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MCL::instrument
+{
+  std::size_t constexpr MAX_KERNELS = 256;        ///< Maximum number of kernel and phase names.
+
+  /// @brief The totals recorded for a kernel.
+
+  struct kernelStats_t
+  {
+    std::string name;
+    std::uint64_t calls = 0;
+    std::uint64_t elements = 0;
+    std::uint64_t bytes = 0;
+    std::uint64_t threads = 0;                    ///< Sum over the calls. (threads / calls is the average.)
+    std::uint64_t nanoseconds = 0;
+  };
+
+  /// @brief A completed scope. Times are in nanoseconds from the first use of the instrumentation.
+
+  struct event_t
+  {
+    char const *name;
+    std::uint64_t start;
+    std::uint64_t duration;
+    std::uint64_t elements;
+    std::uint64_t bytes;
+    std::uint32_t threads;
+    std::uint32_t thread;                         ///< Sequence number of the thread that recorded the event.
+  };
+
+  using callback_t = void (*)(event_t const &, void *);
+
+  std::size_t registerKernel(char const *);
+
+  std::vector<kernelStats_t> snapshot();
+  std::vector<event_t> events();
+  void reset();
+
+  void enableTrace(bool) noexcept;
+  bool traceEnabled() noexcept;
+  void setCallback(callback_t, void * = nullptr);
+
+  std::string toJSON();
+  std::string toChromeTrace();
+
+  /// @brief Records the time from construction to destruction against a kernel.
+
+  class scope_t
+  {
+  private:
+    std::size_t id;
+    std::uint64_t elements;
+    std::uint64_t bytes;
+    std::uint32_t threads = 1;
+    std::uint64_t start;
+    scope_t *parent;
+
+  public:
+    scope_t(std::size_t, std::uint64_t = 0, std::uint64_t = 0) noexcept;
+    scope_t(scope_t const &) = delete;
+    scope_t &operator=(scope_t const &) = delete;
+    ~scope_t();
+
+    void threadsUsed(std::size_t n) noexcept { threads = static_cast<std::uint32_t>(n); }
+
+    static scope_t *current() noexcept;
+  };
+
+  /// @brief Records the number of threads used by the innermost scope of the calling thread.
+
+  inline void threadsUsed(std::size_t n) noexcept
+  {
+    if (scope_t *scope = scope_t::current())
+    {
+      scope->threadsUsed(n);
+    };
+  }
+
+}   // namespace MCL::instrument
+
+#define MCL_INSTRUMENT_CONCAT_(a, b) a##b
+#define MCL_INSTRUMENT_CONCAT(a, b) MCL_INSTRUMENT_CONCAT_(a, b)
+
+#ifdef MCL_INSTRUMENTATION
+
+  /// Records the enclosing block as a kernel. name must be a string literal.
+
+#define MCL_INSTRUMENT_KERNEL(name, elements, bytes) \
+  static std::size_t const MCL_INSTRUMENT_CONCAT(MCL_instrumentId_, __LINE__) = ::MCL::instrument::registerKernel(name); \
+  ::MCL::instrument::scope_t MCL_INSTRUMENT_CONCAT(MCL_instrumentScope_, __LINE__)( \
+    MCL_INSTRUMENT_CONCAT(MCL_instrumentId_, __LINE__), (elements), (bytes))
+
+  /// Records the enclosing block as a phase of the enclosing kernel.
+
+#define MCL_INSTRUMENT_PHASE(name) MCL_INSTRUMENT_KERNEL(name, 0, 0)
+
+  /// Records the number of threads used by the enclosing kernel.
+
+#define MCL_INSTRUMENT_THREADS(n) ::MCL::instrument::threadsUsed(n)
+
+#else
+
+#define MCL_INSTRUMENT_KERNEL(name, elements, bytes) static_cast<void>(0)
+#define MCL_INSTRUMENT_PHASE(name) static_cast<void>(0)
+#define MCL_INSTRUMENT_THREADS(n) static_cast<void>(0)
+
+#endif // MCL_INSTRUMENTATION
+
+#endif // MCL_UTILITY_INSTRUMENT_H
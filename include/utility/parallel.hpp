@@ -0,0 +1,179 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								parallel
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Splitting of a range of elements over a number of threads. This is the same split that the statistics
+//                      functions perform: one contiguous block per thread, with at least 'grain' elements per thread and not
+//                      more than maxThreads threads. (Or the thread limit of the execution context installed for the calling
+//                      thread.)
+//                      With MCL_INSTRUMENTATION the thread count and the spawn and join phases are recorded.
+//
+// CLASSES INCLUDED:    None
+//
+// FUNCTIONS INCLUDED:  threadCount(...)
+//                      parallelFor(...)
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_UTILITY_PARALLEL_HPP
+#define MCL_UTILITY_PARALLEL_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+  // MCL library header files.
+
+#include "../config.h"
+#include "executionContext.h"
+#include "instrument.h"
+
+namespace MCL
+{
+  /// @brief      Determines the number of threads to use for a number of elements.
+  /// @param[in]  count: The number of elements to process.
+  /// @param[in]  grain: The minimum number of elements per thread.
+  /// @returns    The number of threads to use. [1; maxThreads] or [1; executionContext_t::current()->maxThreads()]
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  inline std::size_t threadCount(std::size_t count, std::size_t grain = 1000) noexcept
+  {
+#ifdef MCL_NOMT
+    return 1;
+#else
+    executionContext_t const *context = executionContext_t::current();
+    std::size_t limit = std::max(std::size_t{1}, context ? context->maxThreads() : maxThreads.load(std::memory_order_relaxed));
+
+    return std::min(std::max(std::size_t{1}, count / std::max(std::size_t{1}, grain)), limit);
+#endif
+  }
+
+  /// @brief      Calls fn(indexBegin, indexEnd, threadNumber) for contiguous blocks covering [0; count). The blocks are
+  ///             processed on separate threads, the last block is processed on the calling thread. The function returns once
+  ///             all the blocks have been processed. The worker threads run in the execution context of the calling thread,
+  ///             and are pinned if the context has a CPU list. If a thread cannot be started, the blocks that have not been
+  ///             started are processed on the calling thread.
+  /// @param[in]  count: The number of elements.
+  /// @param[in]  numberOfThreads: The number of blocks (threads). Normally the value returned by threadCount(...). Callers that
+  ///             size per-thread storage must pass the same value that was used to size the storage.
+  /// @param[in]  fn: The function to call for each block. The function must not throw.
+  /// @returns    The number of blocks (threads) used. threadNumber is always less than this value.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename F>
+  std::size_t parallelFor(std::size_t count, std::size_t numberOfThreads, F &&fn)
+  {
+    numberOfThreads = std::max(std::size_t{1}, numberOfThreads);
+
+    MCL_INSTRUMENT_THREADS(numberOfThreads);
+
+    if (numberOfThreads == 1)
+    {
+      fn(std::size_t{0}, count, std::size_t{0});
+    }
+    else
+    {
+      std::size_t stepSize = count / numberOfThreads;
+      std::size_t started = 0;
+      std::vector<std::thread> threadGroup;
+      executionContext_t const *context = executionContext_t::current();
+
+      {
+        MCL_INSTRUMENT_PHASE("parallelFor.spawn");
+
+        try
+        {
+          threadGroup.reserve(numberOfThreads - 1);
+
+          for (; started < (numberOfThreads - 1); started++)
+          {
+            threadGroup.emplace_back([&fn, context](std::size_t b, std::size_t e, std::size_t t)
+            {
+              executionContext_t::scope_t scope(context);
+
+              if (context)
+              {
+                context->enter(t);
+              };
+              fn(b, e, t);
+            }, started * stepSize, (started + 1) * stepSize, started);
+          };
+        }
+        catch (...)
+        {
+            // A thread could not be started (std::system_error or std::bad_alloc). The blocks that have not been started
+            // are processed on the calling thread below.
+        };
+      }
+
+      for (std::size_t threadNumber = started; threadNumber < (numberOfThreads - 1); threadNumber++)
+      {
+        fn(threadNumber * stepSize, (threadNumber + 1) * stepSize, threadNumber);
+      };
+
+      fn((numberOfThreads - 1) * stepSize, count, numberOfThreads - 1);
+
+      {
+        MCL_INSTRUMENT_PHASE("parallelFor.join");
+
+        for (auto &thread: threadGroup)
+        {
+          thread.join();
+        };
+      }
+    };
+
+    return numberOfThreads;
+  }
+
+  /// @brief      Calls fn(indexBegin, indexEnd, threadNumber) for contiguous blocks covering [0; count), using
+  ///             threadCount(count, grain) blocks.
+  /// @param[in]  count: The number of elements.
+  /// @param[in]  fn: The function to call for each block. The function must not throw.
+  /// @param[in]  grain: The minimum number of elements per thread.
+  /// @returns    The number of blocks (threads) used.
+  /// @throws     None.
+  /// @note       Do not use this overload if fn indexes per-thread storage with threadNumber. The thread limit can change
+  ///             between sizing the storage and the call. Call threadCount(...) once and pass the value to parallelFor.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename F>
+  std::size_t parallelFor(std::size_t count, F &&fn, std::size_t grain = 1000)
+  {
+    return parallelFor(count, threadCount(count, grain), std::forward<F>(fn));
+  }
+
+} // namespace MCL
+
+#endif // MCL_UTILITY_PARALLEL_HPP
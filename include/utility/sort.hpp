@@ -5,7 +5,7 @@
 // SUBSYSTEM:						Utility functions
 // LANGUAGE:						C++
 // TARGET OS:						WINDOWS/UNIX/LINUX/MAC
-// LIBRARY DEPENDANCE:	boost
+// LIBRARY DEPENDANCE:	None.
 // NAMESPACE:						MCL
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
@@ -31,7 +31,11 @@
 // FUNCTIONS INCLUDED:  sort(...)
 //
 //
-// HISTORY:             2015-09-22 GGB - astroManager 2015.09 release
+// HISTORY:             2026-10-19 GGB - The helper threads check the cancellation of the calling thread.
+//                      2026-10-19 GGB - Instrumented.
+//                      2026-10-19 GGB - Split to a fixed depth set by the thread limit of the caller.
+//                      2026-10-19 GGB - Use std::jthread and add a cancellation point.
+//                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2013-09-30 GGB - astroManager 2013.09 release.
 //                      2013-07-28 GGB - File Created.
 //
@@ -43,56 +47,137 @@
   // Standard C++ library header files
 
 #include <algorithm>
+#include <exception>
+#include <thread>
 #include <valarray>
 
   // MCL library header files.
 
 #include "../config.h"
-
-#ifndef MCL_NOBOOST
-  // Boost Library
-
-#ifndef MCL_NOMT
-#include <boost/thread.hpp>
-#endif // MCL_NOMT
-
-#endif // MCL_NOBOOST
+#include "cancellation.h"
+#include "executionContext.h"
+#include "instrument.h"
+#include "parallel.hpp"
 
 namespace MCL
 {
+  namespace detail
+  {
+    std::size_t constexpr SORT_CANCEL_GRAIN = 1 << 16;    ///< Block size between the cancellation points of a block.
+
+    /// @brief      Sorts a range by splitting it in two 'depth' times. One half of each split is sorted on a new thread and the
+    ///             halves are merged. If a cancellation is installed, the block of each thread is also sorted in parts of
+    ///             SORT_CANCEL_GRAIN elements that are merged, so that the cancellation is checked regularly.
+    /// @param[in]  begin: Iterator to the begin.
+    /// @param[in]  end: Iterator to the end.
+    /// @param[in]  depth: The number of times to split. The range is sorted by 2^depth threads.
+    /// @param[in]  threadNumber: The number of the thread. The threads started below are numbered threadNumber + 1 to
+    ///             threadNumber + 2^depth - 1. (Used to pin the threads.)
+    /// @throws     MCL::operation_cancelled, MCL::deadline_exceeded - If a cancellation is installed for the calling thread.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename RAIter>
+    void sortSplit(RAIter begin, RAIter end, std::size_t depth, std::size_t threadNumber)
+    {
+      cancellationPoint();
+
+      std::size_t len = std::distance(begin, end);
+      RAIter middle = begin;
+      std::advance(middle, len / 2);
+
+      if (depth == 0)
+      {
+        if ( (cancellation_t::current() == nullptr) || (len <= SORT_CANCEL_GRAIN) )
+        {
+          std::sort(begin, end);
+          return;
+        };
+
+        sortSplit(begin, middle, 0, threadNumber);
+        sortSplit(middle, end, 0, threadNumber);
+      }
+      else
+      {
+        executionContext_t const *context = executionContext_t::current();
+        cancellation_t const *cancellation = cancellation_t::current();
+        std::size_t helperNumber = threadNumber + (std::size_t{1} << (depth - 1));
+        std::exception_ptr exception;
+
+        {
+          std::jthread thread([context, cancellation, &exception, begin, middle, depth, helperNumber]()
+          {
+            executionContext_t::scope_t contextScope(context);
+            cancellation_t::scope_t cancellationScope(cancellation);
+
+            if (context)
+            {
+              context->enter(helperNumber);
+            };
+
+            try
+            {
+              sortSplit(begin, middle, depth - 1, helperNumber);
+            }
+            catch (...)
+            {
+              exception = std::current_exception();
+            };
+          });
+          sortSplit(middle, end, depth - 1, threadNumber);
+        }
+
+        if (exception)
+        {
+          std::rethrow_exception(exception);
+        };
+      };
+
+      cancellationPoint();
+
+      MCL_INSTRUMENT_PHASE("sort.merge");
+      std::inplace_merge(begin, middle, end);
+    }
+  }   // namespace detail
 
   /// @brief Multi-threaded sorting algorithm.
   /// @param[in] begin: Iterator to the begin.
   /// @param[in] end: Iterator to the end.
-  /// @throws None.
+  /// @throws MCL::operation_cancelled, MCL::deadline_exceeded - If a cancellation is installed for the calling thread.
+  /// @note The number of threads is set once from the thread limit of the calling thread (maxThreads or the execution context)
+  ///       and is rounded down to a power of two. The blocks have at least 256 elements. The threads run in the execution
+  ///       context of the calling thread, and are pinned if the context has a CPU list.
+  /// @note The cancellation of the calling thread is also installed for the other threads. It is checked before each block is
+  ///       sorted and merged, and between parts of SORT_CANCEL_GRAIN elements. The threads are joined before the exception
+  ///       propagates.
+  /// @version 2026-10-19/GGB - The cancellation is checked by the helper threads.
+  /// @version 2026-10-19/GGB - Instrumented.
+  /// @version 2026-10-19/GGB - The split depth is calculated once, rather than at each level.
+  /// @version 2026-10-19/GGB - Changed boost::thread to std::jthread so that the thread is joined if the calling thread is
+  ///                           cancelled.
   /// @version 2013-09-22/GGB - Changed std::async to boost::thread.
   /// @version 2013-07-28/GGB - Function created.
 
   template<typename RAIter>
   void sort(RAIter begin, RAIter end)
   {
+    MCL_INSTRUMENT_KERNEL("sort", std::distance(begin, end), std::distance(begin, end) * sizeof(*begin));
+
 #ifdef MCL_NOMT
       // Devolve to using the std::sort algorthm.
+    cancellationPoint();
     std::sort(begin, end);
 #else // MCL_NOMT
-    size_t len = std::distance(begin, end);
-    size_t grainsize = std::max(size_t(256), len/maxThreads);
+    std::size_t len = std::distance(begin, end);
+    std::size_t depth = 0;
 
-    if (len < grainsize)
-    {
-      std::sort(begin, end);
-    }
-    else
+    for (std::size_t threads = threadCount(len, 256); threads > 1; threads /= 2)
     {
-      RAIter middle = begin;
-      std::advance(middle, len/2);
+      depth++;
+    };
 
-      boost::thread thread = boost::thread(MCL::sort<RAIter>, begin, middle);
-      MCL::sort(middle, end);
-      thread.join();
+    MCL_INSTRUMENT_THREADS(std::size_t{1} << depth);
 
-      std::inplace_merge(begin, middle, end);
-    };
+    detail::sortSplit(begin, end, depth, 0);
 #endif
   }
 
@@ -0,0 +1,245 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Math Class Library
+// FILE:								workspace
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Scratch memory for the temporary arrays of the statistics functions. A workspace is a stack of memory
+//                      blocks. Arrays are allocated from the top of the stack and are released together when the scope_t
+//                      that was created before them is destroyed. The blocks are kept, so once a workspace has grown to the
+//                      size needed by a function, further calls of the function do not allocate memory. When the outermost
+//                      scope_t is destroyed, the unused blocks above the retained size (16 MB, or the size passed to reserve())
+//                      are freed, so a call on a large array does not leave the memory held by the thread. trim() frees the
+//                      unused blocks explicitly.
+//                      Each thread has a workspace (workspace_t::local()) that the functions use by default. A workspace may
+//                      also be passed explicitly. A workspace must only be used by one thread at a time.
+//
+// CLASSES INCLUDED:    workspace_t
+//
+// HISTORY:             2026-10-19 GGB - Free the unused blocks above the retained size.
+//                      2026-10-19 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_UTILITY_WORKSPACE_HPP
+#define MCL_UTILITY_WORKSPACE_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace MCL
+{
+  class workspace_t
+  {
+  private:
+    struct block_t
+    {
+      std::unique_ptr<std::byte[]> data;
+      std::size_t size;
+    };
+
+    static std::size_t constexpr BLOCK_SIZE = 16384;   ///< Minimum size of a block.
+    static std::size_t constexpr RETAIN_SIZE = 1 << 24; ///< Default number of bytes kept when the outermost scope ends.
+
+    std::vector<block_t> blocks;
+    std::size_t block = 0;                              ///< The block that is being allocated from.
+    std::size_t offset = 0;                             ///< The number of bytes used in the block.
+    std::size_t depth = 0;                              ///< The number of active scopes.
+    std::size_t retain = RETAIN_SIZE;                   ///< The number of bytes kept when the outermost scope ends.
+
+    /// @brief      Allocates memory from the top of the stack. A new block is added if none of the blocks above the
+    ///             current block are large enough.
+    /// @param[in]  size: The number of bytes.
+    /// @param[in]  alignment: The alignment. (A power of 2.)
+    /// @returns    Pointer to the memory.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::byte *allocateBytes(std::size_t size, std::size_t alignment)
+    {
+      while (block < blocks.size())
+      {
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(blocks[block].data.get());
+        std::size_t aligned = ((base + offset + alignment - 1) & ~(std::uintptr_t{alignment} - 1)) - base;
+
+        if (aligned + size <= blocks[block].size)
+        {
+          offset = aligned + size;
+          return blocks[block].data.get() + aligned;
+        };
+
+        block++;
+        offset = 0;
+      };
+
+      std::size_t blockSize = std::max({ size + alignment, BLOCK_SIZE, blocks.empty() ? 0 : 2 * blocks.back().size });
+
+      blocks.push_back(block_t{ std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize });
+      block = blocks.size() - 1;
+      offset = 0;
+
+      return allocateBytes(size, alignment);
+    }
+
+  protected:
+  public:
+    /// @brief Releases the arrays allocated after the scope was created, when the scope is destroyed. The outermost scope
+    ///        also frees the unused blocks above the retained size.
+
+    class scope_t
+    {
+    private:
+      workspace_t &workspace;
+      std::size_t block;
+      std::size_t offset;
+
+    public:
+      explicit scope_t(workspace_t &ws) noexcept : workspace(ws), block(ws.block), offset(ws.offset)
+      {
+        workspace.depth++;
+      }
+      scope_t(scope_t const &) = delete;
+      scope_t &operator=(scope_t const &) = delete;
+      ~scope_t()
+      {
+        workspace.block = block;
+        workspace.offset = offset;
+        if (--workspace.depth == 0)
+        {
+          workspace.trim(workspace.retain);
+        };
+      }
+    };
+
+    workspace_t() = default;
+    workspace_t(workspace_t const &) = delete;
+    workspace_t(workspace_t &&) noexcept = default;
+    workspace_t &operator=(workspace_t const &) = delete;
+    workspace_t &operator=(workspace_t &&) noexcept = default;
+
+    /// @brief      Constructs a workspace with an initial block.
+    /// @param[in]  size: The size of the initial block. (bytes)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    explicit workspace_t(std::size_t size)
+    {
+      reserve(size);
+    }
+
+    /// @brief      Allocates an array. The values are not initialised.
+    /// @param[in]  count: The number of values.
+    /// @returns    The array. Valid until the enclosing scope_t is destroyed.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename T>
+    std::span<T> allocate(std::size_t count)
+    {
+      static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                    "Workspace arrays must be trivial types.");
+
+      if (count == 0)
+      {
+        return std::span<T>();
+      };
+
+      T *p = reinterpret_cast<T *>(allocateBytes(count * sizeof(T), alignof(T)));
+      std::uninitialized_default_construct_n(p, count);
+
+      return std::span<T>(p, count);
+    }
+
+    /// @brief      Adds a block if the workspace holds fewer than size bytes. The workspace keeps at least size bytes when
+    ///             the outermost scope ends.
+    /// @param[in]  size: The number of bytes.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    void reserve(std::size_t size)
+    {
+      retain = std::max(retain, size);
+
+      if (capacity() < size)
+      {
+        blocks.push_back(block_t{ std::make_unique_for_overwrite<std::byte[]>(size), size });
+      };
+    }
+
+    /// @brief      Frees the unused blocks, largest (most recent) first, until the workspace holds no more than size bytes.
+    ///             Blocks that hold arrays are not freed.
+    /// @param[in]  size: The number of bytes to keep. (0 to free all the unused blocks.)
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void trim(std::size_t size = 0) noexcept
+    {
+      std::size_t held = capacity();
+
+        // The blocks above the current block are unused. So is the current block if nothing has been allocated from it.
+
+      while ( (held > size) && (blocks.size() > block + ((offset == 0) ? 0 : 1)) )
+      {
+        held -= blocks.back().size;
+        blocks.pop_back();
+      };
+    }
+
+    /// @brief      Returns the number of bytes held by the workspace.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::size_t capacity() const noexcept
+    {
+      std::size_t total = 0;
+
+      for (block_t const &b : blocks)
+      {
+        total += b.size;
+      };
+
+      return total;
+    }
+
+    /// @brief      Returns the workspace of the calling thread.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    static workspace_t &local() noexcept
+    {
+      thread_local workspace_t workspace;
+
+      return workspace;
+    }
+  };
+
+}   // namespace MCL
+
+#endif // MCL_UTILITY_WORKSPACE_HPP
@@ -29,59 +29,40 @@ namespace MCL
     point_t const &P2() const noexcept { return p2; }
     point_t &P2() noexcept { return p2; }
 
-    T angle()
-    {
-      T distX, distY, rad, angle;
+    /// @brief Returns the orientation of the vector (the angle of P2 - P1 from the x axis).
+    /// @returns The angle in [0; 2PI). Zero if the points are coincident (within the zero tolerance).
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Use atan2. The acos/asin quadrant corrections gave incorrect angles in the second and
+    ///                           fourth quadrants.
 
-      distX = p2.X() - p1.X();
-      distY = p2.Y() - p1.Y();
-      rad = sqrt(distX * distX + distY * distY);
+    T angle() const noexcept
+    {
+      T distX = p2.X() - p1.X();
+      T distY = p2.Y() - p1.Y();
+      T angle = 0;
 
-      if (fabs(rad) >= zeroTolerance)
+      if ( (std::fabs(distX) >= zeroTolerance) || (std::fabs(distY) >= zeroTolerance) )
       {
-        if (fabs(distX) > zeroTolerance)
-        {
-          angle = acos(distX / rad);
-        }
-        else
-        {
-          angle = asin(distY / rad);
-        }
-
-        // Correct the angle.
+        angle = std::atan2(distY, distX);
 
-        if (distX > 0)
-        {
-          if (distY > 0)
-          {
-            // No change to the angle.
-          }
-          else
-          {
-            angle += PI + PI_DIV_2;
-          }
-        }
-        else
+        if (angle < 0)
         {
-          if (distY > 0)
-          {
-            angle += PI_DIV_2;
-          }
-          else
-          {
-            angle += PI;
-          }
-        }
-      }
-      else
-      {
-        angle = 0;   // Same point???
-      }
+          angle += PI_2;
+        };
+      };
 
       return angle;
-
     }
 
+    /// @brief Returns the length of the vector.
+    /// @returns The distance between P1 and P2.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
+
+    T length() const noexcept
+    {
+      return std::hypot(p2.X() - p1.X(), p2.Y() - p1.Y());
+    }
 
   protected:
   private:
@@ -0,0 +1,355 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Maths Class Library
+// FILE:								vector3DArray
+// SUBSYSTEM:						3D vector template class
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman (GGB)
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+//
+// OVERVIEW:						A batch of 3D vectors stored as a structure of arrays. (x[], y[], z[])
+//                      The batch functions are written as simple loops over the component arrays, so that the compiler can
+//                      vectorise them. Large batches are split over threads.
+//
+// CLASSES INCLUDED:		vector3DArray_t
+//
+// CLASS HIERARCHY:     vector3DArray_t
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef MCL_VECTOR3DARRAY_HPP
+#define MCL_VECTOR3DARRAY_HPP
+
+  // Standard C++ library header files.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+  // MCL library header files.
+
+#include "TVector3D.hpp"
+#include "utility/parallel.hpp"
+
+namespace MCL
+{
+  template<typename T>
+  class vector3DArray_t
+  {
+  public:
+    using matrix_t = std::array<std::array<T, 3>, 3>;     ///< Row major 3x3 matrix.
+
+  private:
+    static std::size_t constexpr GRAIN = 10000;           ///< Minimum number of vectors per thread.
+
+    std::vector<T> x_;
+    std::vector<T> y_;
+    std::vector<T> z_;
+
+    /// @brief      Checks that an output array is large enough.
+    /// @param[in]  size: The size of the output array.
+    /// @throws     std::invalid_argument
+    /// @version    2026-10-19/GGB - Function created.
+
+    void checkSize(std::size_t size) const
+    {
+      if (size < x_.size())
+      {
+        throw std::invalid_argument("MCL::vector3DArray_t - Destination array too small.");
+      };
+    }
+
+  protected:
+  public:
+    vector3DArray_t() = default;
+
+    /// @brief      Constructs a batch of zero vectors.
+    /// @param[in]  count: The number of vectors.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    explicit vector3DArray_t(std::size_t count) : x_(count), y_(count), z_(count) {}
+
+    /// @brief      Constructs a batch from an array of vectors. (AoS to SoA)
+    /// @param[in]  vectors: The vectors to copy.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    explicit vector3DArray_t(std::span<TVector3D<T> const> vectors) : x_(vectors.size()), y_(vectors.size()), z_(vectors.size())
+    {
+      for (std::size_t index = 0; index < vectors.size(); index++)
+      {
+        x_[index] = vectors[index].x();
+        y_[index] = vectors[index].y();
+        z_[index] = vectors[index].z();
+      };
+    }
+
+    /// @brief      Copies the batch to an array of vectors. (SoA to AoS)
+    /// @param[out] vectors: The destination array. Must be at least as large as the batch.
+    /// @throws     std::invalid_argument - Destination too small.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void toAoS(std::span<TVector3D<T>> vectors) const
+    {
+      checkSize(vectors.size());
+
+      for (std::size_t index = 0; index < x_.size(); index++)
+      {
+        vectors[index] = TVector3D<T>(x_[index], y_[index], z_[index]);
+      };
+    }
+
+    std::size_t size() const noexcept { return x_.size(); }
+    bool empty() const noexcept { return x_.empty(); }
+    void resize(std::size_t newSize) { x_.resize(newSize); y_.resize(newSize); z_.resize(newSize); }
+    void reserve(std::size_t capacity) { x_.reserve(capacity); y_.reserve(capacity); z_.reserve(capacity); }
+    void clear() noexcept { x_.clear(); y_.clear(); z_.clear(); }
+
+    /// @brief      Appends a vector to the batch.
+    /// @param[in]  vector: The vector to append.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    void push_back(TVector3D<T> const &vector)
+    {
+      x_.push_back(vector.x());
+      y_.push_back(vector.y());
+      z_.push_back(vector.z());
+    }
+
+    /// @brief      Returns the vector at an index.
+    /// @param[in]  index: The index of the vector.
+    /// @returns    The vector.
+    /// @throws     std::out_of_range
+    /// @version    2026-10-19/GGB - Function created.
+
+    TVector3D<T> at(std::size_t index) const
+    {
+      return TVector3D<T>(x_.at(index), y_.at(index), z_.at(index));
+    }
+
+    /// @brief      Sets the vector at an index.
+    /// @param[in]  index: The index of the vector.
+    /// @param[in]  vector: The new value.
+    /// @throws     std::out_of_range
+    /// @version    2026-10-19/GGB - Function created.
+
+    void set(std::size_t index, TVector3D<T> const &vector)
+    {
+      x_.at(index) = vector.x();
+      y_.at(index) = vector.y();
+      z_.at(index) = vector.z();
+    }
+
+    std::span<T> x() noexcept { return x_; }
+    std::span<T> y() noexcept { return y_; }
+    std::span<T> z() noexcept { return z_; }
+    std::span<T const> x() const noexcept { return x_; }
+    std::span<T const> y() const noexcept { return y_; }
+    std::span<T const> z() const noexcept { return z_; }
+
+    /// @brief      Calculates the dot product of each vector with the corresponding vector of another batch.
+    /// @param[in]  rhs: The other batch. Must be the same size.
+    /// @param[out] result: The dot products. Must be at least as large as the batch.
+    /// @throws     std::invalid_argument - Size mismatch.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void dot(vector3DArray_t const &rhs, std::span<T> result) const
+    {
+      if (rhs.size() != size())
+      {
+        throw std::invalid_argument("MCL::vector3DArray_t::dot - Batch sizes differ.");
+      };
+      checkSize(result.size());
+
+      T const *ax = x_.data(), *ay = y_.data(), *az = z_.data();
+      T const *bx = rhs.x_.data(), *by = rhs.y_.data(), *bz = rhs.z_.data();
+      T *r = result.data();
+
+      parallelFor(size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          r[index] = ax[index] * bx[index] + ay[index] * by[index] + az[index] * bz[index];
+        };
+      }, GRAIN);
+    }
+
+    /// @brief      Calculates the cross product of each vector with the corresponding vector of another batch.
+    /// @param[in]  rhs: The other batch. Must be the same size.
+    /// @param[out] result: The cross products. Resized to the batch size. May be *this or rhs.
+    /// @throws     std::invalid_argument - Size mismatch.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    void cross(vector3DArray_t const &rhs, vector3DArray_t &result) const
+    {
+      if (rhs.size() != size())
+      {
+        throw std::invalid_argument("MCL::vector3DArray_t::cross - Batch sizes differ.");
+      };
+      result.resize(size());
+
+      T const *ax = x_.data(), *ay = y_.data(), *az = z_.data();
+      T const *bx = rhs.x_.data(), *by = rhs.y_.data(), *bz = rhs.z_.data();
+      T *rx = result.x_.data(), *ry = result.y_.data(), *rz = result.z_.data();
+
+      parallelFor(size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          T x1 = ax[index], y1 = ay[index], z1 = az[index];
+          T x2 = bx[index], y2 = by[index], z2 = bz[index];
+
+          rx[index] = y1 * z2 - z1 * y2;
+          ry[index] = z1 * x2 - x1 * z2;
+          rz[index] = x1 * y2 - y1 * x2;
+        };
+      }, GRAIN);
+    }
+
+    /// @brief      Calculates the length of each vector.
+    /// @param[out] result: The lengths. Must be at least as large as the batch.
+    /// @throws     std::invalid_argument - Destination too small.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void length(std::span<T> result) const
+    {
+      checkSize(result.size());
+
+      T const *ax = x_.data(), *ay = y_.data(), *az = z_.data();
+      T *r = result.data();
+
+      parallelFor(size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          r[index] = std::sqrt(ax[index] * ax[index] + ay[index] * ay[index] + az[index] * az[index]);
+        };
+      }, GRAIN);
+    }
+
+    /// @brief      Normalises each vector to unit length. A zero vector results in NaN components, as for
+    ///             TVector3D::normalise()
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void normalise()
+    {
+      static_assert(std::is_floating_point_v<T>, "MCL::vector3DArray_t::normalise - Floating point type required.");
+
+      T *ax = x_.data(), *ay = y_.data(), *az = z_.data();
+
+      parallelFor(size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          T invlen = T(1) / std::sqrt(ax[index] * ax[index] + ay[index] * ay[index] + az[index] * az[index]);
+
+          ax[index] *= invlen;
+          ay[index] *= invlen;
+          az[index] *= invlen;
+        };
+      }, GRAIN);
+    }
+
+    /// @brief      Rounds each component down. Has no effect for integer types.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void floor()
+    {
+      if constexpr (std::is_floating_point_v<T>)
+      {
+        apply([](T v) { return std::floor(v); });
+      };
+    }
+
+    /// @brief      Rounds each component up. Has no effect for integer types.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void ceil()
+    {
+      if constexpr (std::is_floating_point_v<T>)
+      {
+        apply([](T v) { return std::ceil(v); });
+      };
+    }
+
+    /// @brief      Multiplies each vector by a matrix. (v' = M.v)
+    /// @param[in]  matrix: The row major 3x3 matrix.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void transform(matrix_t const &matrix)
+    {
+      T const m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2];
+      T const m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2];
+      T const m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2];
+      T *ax = x_.data(), *ay = y_.data(), *az = z_.data();
+
+      parallelFor(size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          T x = ax[index], y = ay[index], z = az[index];
+
+          ax[index] = m00 * x + m01 * y + m02 * z;
+          ay[index] = m10 * x + m11 * y + m12 * z;
+          az[index] = m20 * x + m21 * y + m22 * z;
+        };
+      }, GRAIN);
+    }
+
+  private:
+    /// @brief      Applies a function to each component of each vector.
+    /// @param[in]  fn: The function to apply.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename F>
+    void apply(F fn)
+    {
+      for (std::vector<T> *component : {&x_, &y_, &z_})
+      {
+        T *a = component->data();
+
+        parallelFor(size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+        {
+          for (std::size_t index = indexBegin; index < indexEnd; index++)
+          {
+            a[index] = fn(a[index]);
+          };
+        }, GRAIN);
+      };
+    }
+  };
+
+}   // namespace MCL
+
+#endif // MCL_VECTOR3DARRAY_HPP
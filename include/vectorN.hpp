@@ -3,14 +3,18 @@
  *
  *  Created on: 26 July 2025
  *      Author: gavin
+ *
+ *  2026-10-19/GGB - Storage changed from std::valarray to std::array. The vector no longer allocates, is trivially copyable
+ *                   for trivial T and the arithmetic is constexpr.
  */
 
 #ifndef MCL_INCLUDE_VECTORN_HPP_
 #define MCL_INCLUDE_VECTORN_HPP_
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <tuple>
-#include <valarray>
+#include <type_traits>
 
 namespace MCL
 {
@@ -23,75 +27,133 @@ namespace MCL
   public:
     using axisType_t = std::uint8_t;
 
-    vectorN() : value(N) {}
-    ~vectorN() = default;
-    vectorN(vectorN const &) = default;
-    vectorN(vectorN &&) = default;
-    vectorN &operator=(vectorN const &) = default;
-    vectorN &operator=(vectorN &&) = delete;
+    constexpr vectorN() noexcept = default;
+    constexpr vectorN(vectorN const &) noexcept = default;
+    constexpr vectorN(vectorN &&) noexcept = default;
+    constexpr vectorN &operator=(vectorN const &) noexcept = default;
+    constexpr vectorN &operator=(vectorN &&) noexcept = default;
+
+    /// @brief Constructs the vector from N values.
+    /// @param[in] args: The component values.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
 
     template<typename... Args>
-    constexpr vectorN &operator=(Args &&... args)
+    requires (sizeof...(Args) == N && N > 1)
+    constexpr vectorN(Args... args) noexcept : value{{ static_cast<T>(args)... }} {}
+
+    /// @brief Sets all the components of the vector.
+    /// @param[in] args: The component values.
+    /// @returns *this
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Replaces the variadic operator=, which could not be called with more than one value.
+
+    template<typename... Args>
+    requires (sizeof...(Args) == N)
+    constexpr vectorN &set(Args... args) noexcept
     {
-      value = {{ args... }};
+      value = {{ static_cast<T>(args)... }};
+      return *this;
     }
 
-    T &operator[](axisType_t n)
+    static constexpr std::size_t size() noexcept { return N; }
+
+    constexpr T *data() noexcept { return value.data(); }
+    constexpr T const *data() const noexcept { return value.data(); }
+
+    constexpr T &operator[](axisType_t n) noexcept
     {
       return value[n];
     }
 
-    T const &operator[](axisType_t n) const
+    constexpr T const &operator[](axisType_t n) const noexcept
     {
       return value[n];
     }
 
-    vectorN &operator+=(vectorN rhs)
+    constexpr bool operator==(vectorN const &) const noexcept = default;
+
+    constexpr vectorN &operator+=(vectorN const &rhs) noexcept
     {
-      value += rhs.value;
-      return *this; // return the result by value (uses move constructor)
+      for (std::size_t i = 0; i < N; i++)
+      {
+        value[i] += rhs.value[i];
+      }
+      return *this;
     }
 
-    vectorN operator+(vectorN rhs)
+    constexpr vectorN operator+(vectorN const &rhs) const noexcept
     {
       vectorN rv(*this);
-      rv.value += rhs.value;
-      return rv; // return the result by value (uses move constructor)
+      rv += rhs;
+      return rv;
     }
 
-    vectorN &operator-=(vectorN rhs)
+    constexpr vectorN &operator-=(vectorN const &rhs) noexcept
     {
-      value -= rhs.value;
-      return *this; // return the result by value (uses move constructor)
+      for (std::size_t i = 0; i < N; i++)
+      {
+        value[i] -= rhs.value[i];
+      }
+      return *this;
     }
 
-    vectorN operator-(vectorN rhs)
+    constexpr vectorN operator-(vectorN const &rhs) const noexcept
     {
       vectorN rv(*this);
-      rv.value -= rhs.value;
-      return rv; // return the result by value (uses move constructor)
+      rv -= rhs;
+      return rv;
+    }
+
+    constexpr vectorN operator-() const noexcept
+    {
+      vectorN rv;
+      for (std::size_t i = 0; i < N; i++)
+      {
+        rv.value[i] = -value[i];
+      }
+      return rv;
     }
 
     template<typename VT>
-    vectorN &operator*=(VT rhs)
+    constexpr vectorN &operator*=(VT rhs) noexcept
     {
-      value *= rhs;
-      return *this; // return the result by value (uses move constructor)
+      for (std::size_t i = 0; i < N; i++)
+      {
+        value[i] *= rhs;
+      }
+      return *this;
     }
 
+    /// @brief Dot product of two vectors.
+    /// @param[in] rhs: The other vector.
+    /// @returns The dot product.
+    /// @throws None.
+    /// @version 2026-10-19/GGB - Function created.
 
+    constexpr T dot(vectorN const &rhs) const noexcept
+    {
+      T rv = 0;
+      for (std::size_t i = 0; i < N; i++)
+      {
+        rv += value[i] * rhs.value[i];
+      }
+      return rv;
+    }
 
   private:
-    std::valarray<T> value;
+    std::array<T, N> value = {};
 
     template<typename VT>
-    friend vectorN operator*(vectorN lhs, VT rhs)
+    friend constexpr vectorN operator*(vectorN lhs, VT rhs) noexcept
     {
       lhs *= rhs;
-      return lhs; // return the result by value (uses move constructor)
+      return lhs;
     }
   };
 
+  static_assert(std::is_trivially_copyable_v<vectorN<double, 3>>);
+
 }
 
 #endif /* MCL_INCLUDE_VECTORN_HPP_ */
@@ -26,15 +26,17 @@
 //
 // OVERVIEW:
 //
-// HISTORY:             2015-09-22 GGB - astroManager 2015.09 release
+// HISTORY:             2026-10-19 GGB - maxThreads defaults to the CPUs available to the process.
+//                      2015-09-22 GGB - astroManager 2015.09 release
 //
 //*********************************************************************************************************************************
 
 #include "../include/config.h"
-
-#include <thread>
+#include "../include/utility/executionContext.h"
 
 namespace MCL
 {
-  size_t maxThreads = std::thread::hardware_concurrency();      // Default number of threads used for the multi-threaded functions.
+    // Default number of threads used for the multi-threaded functions. (Allowing for the CPU affinity and cgroup CPU quota.)
+
+  std::atomic<size_t> maxThreads = availableConcurrency();
 }
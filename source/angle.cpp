@@ -30,7 +30,9 @@
 //
 // CLASS HIERARCHY:     CAngle
 //
-// HISTORY:             2020-03-21 GGB - Added negation operator for CAngle
+// HISTORY:             2026-10-19 GGB - String conversions use sexagesimalToChars(). A2SD() implemented.
+//                      2026-10-19 GGB - Fixed recursion in sin/cos/tan(CAngle).
+//                      2020-03-21 GGB - Added negation operator for CAngle
 //                      2015-09-27 GGB - File Created
 //
 //*********************************************************************************************************************************
@@ -41,6 +43,13 @@
 
 #include "include/constants.h"
 #include "include/exceptions.h"
+#include "include/sexagesimal.h"
+
+  // Standard C++ library header files.
+
+#include <charconv>
+#include <cmath>
+#include <system_error>
 
   // Miscellaneous libraries
 
@@ -73,28 +82,31 @@ namespace MCL
   /// @param[in] angle: The angle to take the sin of.
   /// @returns The sine of the angle.
   /// @throws None.
+  /// @version 2026-10-19/GGB - Call std::sin. (The unqualified call resolved to this function through CAngle(FP_t).)
   /// @version 2017-09-23/GGB - Function created.
 
   FP_t sin(CAngle const &angle)
   {
-    return (sin(angle.angle_));
+    return (std::sin(angle.angle_));
   }
 
   /// @brief Returns the cosine of an angle.
   /// @param[in] angle: The angle to take the cos of.
   /// @returns The cosine of the angle.
   /// @throws None.
+  /// @version 2026-10-19/GGB - Call std::cos.
   /// @version 2017-09-23/GGB - Function created.
 
   FP_t cos(CAngle const &angle)
   {
-    return (cos(angle.angle_));
+    return (std::cos(angle.angle_));
   }
 
   /// @brief Returns the tangent of an angle.
   /// @param[in] angle - The angle to take the tangent of.
   /// @returns The tangent of the angle.
   /// @throws divide_by_zero()
+  /// @version 2026-10-19/GGB - Call std::tan.
   /// @version 2017-09-23/GGB - Function created.
 
   FP_t tan(CAngle const &angle)
@@ -105,7 +117,7 @@ namespace MCL
     }
     else
     {
-      return (tan(angle.angle_));
+      return (std::tan(angle.angle_));
     };
   }
 
@@ -196,21 +208,42 @@ namespace MCL
   /// @brief Converts the angle to a string of the form HH:mm:ss.ss"
   /// @returns A string representation of the angle.
   /// @throws None.
+  /// @version 2026-10-19/GGB - Use sexagesimalToChars(). (No intermediate allocations.)
   /// @version 2017-09-24/GGB - Function created.
 
   std::string CAngle::A2SHMS() const
   {
-    return GCL::sprintfHMS(hours());
+    char buffer[32];
+    std::to_chars_result result = sexagesimalToChars(buffer, buffer + sizeof(buffer), hours(), SF_SEPARATED, 2);
+
+    return (result.ec == std::errc()) ? std::string(buffer, result.ptr) : std::string();
   }
 
   /// @brief Converts the angle to a string of the form dd:mm:ss.ss"
   /// @returns A string representation of the angle.
   /// @throws None.
+  /// @version 2026-10-19/GGB - Use sexagesimalToChars(). (No intermediate allocations.)
   /// @version 2017-09-24/GGB - Function created.
 
   std::string CAngle::A2SDMS() const
   {
-    return GCL::sprintfDMS(degrees());
+    char buffer[32];
+    std::to_chars_result result = sexagesimalToChars(buffer, buffer + sizeof(buffer), degrees(), SF_SEPARATED, 2);
+
+    return (result.ec == std::errc()) ? std::string(buffer, result.ptr) : std::string();
+  }
+
+  /// @brief Converts the angle to a string of the form d.dddddd
+  /// @returns A string representation of the angle.
+  /// @throws None.
+  /// @version 2026-10-19/GGB - Function created. (Previously returned an empty string.)
+
+  std::string CAngle::A2SD() const
+  {
+    char buffer[32];
+    std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), degrees(), std::chars_format::fixed, 6);
+
+    return (result.ec == std::errc()) ? std::string(buffer, result.ptr) : std::string();
   }
 
   /// @brief Convert an angle in a specified format to radians.
@@ -219,6 +252,8 @@ namespace MCL
   /// @returns The angle in radians.
   /// @throws GCL::CError(MCL, 0x0100)
   /// @throws GCL::CCodeError(MCL)
+  /// @version 2026-10-19/GGB - Packed values are converted with unpackSexagesimal(). The minutes and seconds of HMS values
+  ///                           are now also converted to degrees, and negative packed values are supported.
   /// @version 2015-09-27/GGB - Function created.
 
   FP_t CAngle::convertToRadians(FP_t value, EAngleFormat af)
@@ -239,43 +274,12 @@ namespace MCL
       };
       case AF_DMSs:   // format = DDMMSS.ssssss
       {
-        FP_t temp;
-
-        value /= 10000;
-        returnValue = std::floor(value);
-        value -= returnValue;
-        value *= 100;
-        temp = std::floor(value);
-        returnValue += temp / D_MPH;     // minutes
-        value -= temp;
-        value *= 100;
-        temp = std::floor(value);
-        returnValue += temp / D_SPH;   // seconds
-        value -= temp;
-        value /= D_SPH;
-        returnValue += value;
-        returnValue *= D_D2R;
+        returnValue = unpackSexagesimal(value) * D_D2R;
         break;
       };
       case AF_HMSs:    // format = HHMMSS.ssssss
       {
-        FP_t temp;
-
-        value /= 10000;
-        returnValue = std::floor(value);
-        value -= returnValue;
-        returnValue *= D_DPH;                 // Degrees
-        value *= 100;
-        temp = std::floor(value);
-        returnValue += temp / D_MPH;             // minutes
-        value -= temp;
-        value *= 100;
-        temp = std::floor(value);
-        returnValue += temp / D_SPH;          // seconds
-        value -= temp;
-        value /= D_SPH;
-        returnValue += value;
-        returnValue *= D_D2R;
+        returnValue = unpackSexagesimal(value) * D_DPH * D_D2R;
         break;
       };
       case AF_RADIANS:
@@ -294,19 +298,12 @@ namespace MCL
 
   /// @brief Converts the angle value into an hh.hhh value.
   /// @returns angle converted to hh.hhhh
+  /// @version 2026-10-19/GGB - The fractional degrees are also converted to hours.
   /// @version 2018-05-12/GGB - Corrected error with conversion.
 
   FP_t CAngle::hours() const
   {
-    FP_t returnValue = std::fabs(angle_ * D_R2D);
-    FP_t hrsValue, fractionalPart;
-
-    fractionalPart = std::modf(returnValue, &hrsValue);
-    hrsValue /= D_DPH;
-
-    returnValue = hrsValue + fractionalPart;
-
-    return returnValue;
+    return std::fabs(angle_ * D_R2H);
   }
 
 }   // namespace MCL
@@ -0,0 +1,279 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Maths Class Library
+// FILE:								angleArray
+// SUBSYSTEM:						Angle class
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman (GGB)
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+//
+// OVERVIEW:						An array of angles.
+//
+// CLASSES INCLUDED:		angleArray_t
+//
+// CLASS HIERARCHY:     angleArray_t
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#include "include/angleArray.h"
+
+  // Standard C++ library header files.
+
+#include <cmath>
+#include <stdexcept>
+
+  // MCL library header files.
+
+#include "include/sexagesimal.h"
+#include "include/trigonometryArray.hpp"
+#include "include/utility/parallel.hpp"
+
+namespace MCL
+{
+  namespace
+  {
+    /// @brief      Applies a function to each element of an array. The array is split over threads for large arrays.
+    /// @param[in]  src: The source array.
+    /// @param[out] dest: The destination array. Must be at least as large as src. May be the same as src.
+    /// @param[in]  fn: The function to apply.
+    /// @throws     std::invalid_argument - Destination too small.
+    /// @version    2026-10-19/GGB - Function created.
+
+    template<typename F>
+    void transformAngles(std::span<FP_t const> src, std::span<FP_t> dest, F fn)
+    {
+      if (dest.size() < src.size())
+      {
+        throw std::invalid_argument("MCL::angleArray_t - Destination array too small.");
+      };
+
+      parallelFor(src.size(), [&](std::size_t indexBegin, std::size_t indexEnd, std::size_t)
+      {
+        for (std::size_t index = indexBegin; index < indexEnd; index++)
+        {
+          dest[index] = fn(src[index]);
+        };
+      }, 10000);
+    }
+  }
+
+  /// @brief      Constructs an array of angles with the same value.
+  /// @param[in]  count: The number of angles.
+  /// @param[in]  value: The value of each angle. (radians)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  angleArray_t::angleArray_t(std::size_t count, FP_t value) : angles_(count, value)
+  {
+  }
+
+  /// @brief      Constructs an array of angles from values in a specified format.
+  /// @param[in]  values: The values to convert.
+  /// @param[in]  af: The format of the values.
+  /// @throws     std::invalid_argument - Invalid format.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  angleArray_t::angleArray_t(std::span<FP_t const> values, EAngleFormat af)
+  {
+    assign(values, af);
+  }
+
+  /// @brief      Constructs an array of angles from an array of CAngle values.
+  /// @param[in]  values: The angles to copy.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  angleArray_t::angleArray_t(std::span<CAngle const> values)
+  {
+    angles_.reserve(values.size());
+
+    for (CAngle const &angle : values)
+    {
+      angles_.push_back(angle.radians());
+    };
+  }
+
+  /// @brief      Replaces the angles with values in a specified format.
+  /// @param[in]  values: The values to convert.
+  /// @param[in]  af: The format of the values.
+  /// @throws     std::invalid_argument - Invalid format.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::assign(std::span<FP_t const> values, EAngleFormat af)
+  {
+    angles_.resize(values.size());
+
+    switch (af)
+    {
+      case AF_Dd:
+      {
+        transformAngles(values, angles_, [](FP_t v) { return v * D_D2R; });
+        break;
+      };
+      case AF_DMSs:
+      {
+        transformAngles(values, angles_, [](FP_t v) { return unpackSexagesimal(v) * D_D2R; });
+        break;
+      };
+      case AF_HMSs:
+      {
+        transformAngles(values, angles_, [](FP_t v) { return unpackSexagesimal(v) * D_DPH * D_D2R; });
+        break;
+      };
+      case AF_RADIANS:
+      {
+        transformAngles(values, angles_, [](FP_t v) { return v; });
+        break;
+      };
+      case AF_NONE:
+      default:
+      {
+        throw std::invalid_argument("MCL::angleArray_t - Invalid angle format.");
+        break;
+      };
+    };
+  }
+
+  /// @brief      Converts the angles to a specified format.
+  /// @param[out] dest: The converted angles. Must be at least as large as the array.
+  /// @param[in]  af: The format to convert to.
+  /// @throws     std::invalid_argument - Invalid format or destination too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::convert(std::span<FP_t> dest, EAngleFormat af) const
+  {
+    switch (af)
+    {
+      case AF_Dd:
+      {
+        transformAngles(angles_, dest, [](FP_t v) { return v * D_R2D; });
+        break;
+      };
+      case AF_DMSs:
+      {
+        transformAngles(angles_, dest, [](FP_t v) { return packSexagesimal(v * D_R2D); });
+        break;
+      };
+      case AF_HMSs:
+      {
+        transformAngles(angles_, dest, [](FP_t v) { return packSexagesimal(v * D_R2H); });
+        break;
+      };
+      case AF_RADIANS:
+      {
+        transformAngles(angles_, dest, [](FP_t v) { return v; });
+        break;
+      };
+      case AF_NONE:
+      default:
+      {
+        throw std::invalid_argument("MCL::angleArray_t - Invalid angle format.");
+        break;
+      };
+    };
+  }
+
+  /// @brief      Converts the angles to hours. (H.hhhh)
+  /// @param[out] dest: The angles in hours. Must be at least as large as the array.
+  /// @throws     std::invalid_argument - Destination too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::hours(std::span<FP_t> dest) const
+  {
+    transformAngles(angles_, dest, [](FP_t v) { return v * D_R2H; });
+  }
+
+  /// @brief      Normalises the angles into the range [0; range)
+  /// @param[in]  range: The range. (Normally 2*PI)
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::moduloN(FP_t range)
+  {
+    transformAngles(angles_, angles_, [range](FP_t v)
+    {
+      FP_t r = v - range * std::floor(v / range);
+      return (r >= range) ? 0 : r;                      // Tiny negative values round up to range.
+    });
+  }
+
+  /// @brief      Normalises the angles into the range [-range; range)
+  /// @param[in]  range: The range. (Normally PI)
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::moduloR(FP_t range)
+  {
+    FP_t range2 = range * 2;
+
+    transformAngles(angles_, angles_, [range, range2](FP_t v)
+    {
+      v += range;
+      FP_t r = v - range2 * std::floor(v / range2);
+      return ((r >= range2) ? 0 : r) - range;
+    });
+  }
+
+  /// @brief      Calculates the sine of the angles.
+  /// @param[out] dest: sin(angle). Must be at least as large as the array.
+  /// @throws     std::invalid_argument - Destination too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::sin(std::span<FP_t> dest) const
+  {
+    MCL::sin(radians(), dest);
+  }
+
+  /// @brief      Calculates the cosine of the angles.
+  /// @param[out] dest: cos(angle). Must be at least as large as the array.
+  /// @throws     std::invalid_argument - Destination too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::cos(std::span<FP_t> dest) const
+  {
+    MCL::cos(radians(), dest);
+  }
+
+  /// @brief      Calculates the tangent of the angles.
+  /// @param[out] dest: tan(angle). Must be at least as large as the array.
+  /// @throws     std::invalid_argument - Destination too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::tan(std::span<FP_t> dest) const
+  {
+    MCL::tan(radians(), dest);
+  }
+
+  /// @brief      Calculates the sine and cosine of the angles.
+  /// @param[out] s: sin(angle). Must be at least as large as the array.
+  /// @param[out] c: cos(angle). Must be at least as large as the array.
+  /// @throws     std::invalid_argument - Destination too small.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void angleArray_t::sincos(std::span<FP_t> s, std::span<FP_t> c) const
+  {
+    MCL::sincos(radians(), s, c);
+  }
+
+}   // namespace MCL
@@ -2,11 +2,15 @@
 
 #include <cmath>
 #include <iostream>
+#include <span>
+
+#include "include/utility/cancellation.h"
+#include "include/utility/instrument.h"
 
 namespace MCL
 {
 
-  static double solver(cashflowVector_t const &cashflows, std::vector<double> const &diffDates, double rate)
+  static double solver(cashflowVector_t const &cashflows, std::span<double const> diffDates, double rate)
   {
     double rv = 0;
     std::size_t i;
@@ -24,21 +28,30 @@ namespace MCL
   /// @brief      Calculate the internal rate of return for a sequence of cash flows.
   /// @param[in]  cashflows: A sequence of cashflows (Dates and values)
   /// @param[in]  prec: The required precision.
+  /// @param[in]  workspace: Scratch memory for the periods of the cashflows.
+  /// @throws     MCL::operation_cancelled, MCL::deadline_exceeded - If a cancellation is installed for the calling thread.
+  ///             (Checked on each iteration.)
+  /// @version    2026-10-19/GGB - Periods allocated from a workspace.
   /// @version    2023-07-17/GGB - Function created.
 
-  double XIRR(cashflowVector_t const &cashflows, double prec)
+  double XIRR(cashflowVector_t const &cashflows, double prec, workspace_t &workspace)
   {
+    MCL_INSTRUMENT_KERNEL("XIRR", cashflows.size(), cashflows.size() * sizeof(cashflowVector_t::value_type));
+
     bool allPositive = true, allNegative = true, allZero = true;
-    std::vector<double> diffDates;
 
     if (cashflows.size() == 0)
     {
       throw std::runtime_error("MCL::XIRR() - No data provided.");
     }
 
+    workspace_t::scope_t scope(workspace);
+    std::span<double> diffDates = workspace.allocate<double>(cashflows.size());
+    std::size_t indx = 0;
+
     for (auto const &cf: cashflows)
     {
-      diffDates.push_back((double) std::chrono::duration_cast<std::chrono::days>(cashflows.back().first - cf.first).count() / 365);
+      diffDates[indx++] = (double) std::chrono::duration_cast<std::chrono::days>(cashflows.back().first - cf.first).count() / 365;
 
       if (cf.second > 0)
       {
@@ -85,6 +98,8 @@ namespace MCL
 
     while (std::abs(fMid) > prec)
     {
+      cancellationPoint();
+
       if (std::signbit(fMin) == std::signbit(fMax))
       {
         throw std::runtime_error("MCL::XIRR() - Unable to converge.");
@@ -113,4 +128,17 @@ namespace MCL
     return rMid;
 
   }
+
+  /// @brief      Calculate the internal rate of return for a sequence of cash flows on an executor.
+  /// @param[in]  options: The stop token, deadline and executor for the call.
+  /// @param[in]  cashflows: A sequence of cashflows (Dates and values)
+  /// @param[in]  prec: The required precision.
+  /// @returns    A future for the rate.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::future<double> XIRR(asyncOptions_t const &options, cashflowVector_t cashflows, double prec)
+  {
+    return MCL::async(options, [cashflows = std::move(cashflows), prec]() { return XIRR(cashflows, prec); });
+  }
 }
@@ -0,0 +1,323 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								columnFile
+// SUBSYSTEM:						Input/Output
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Binary column file reader and writer.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/io/columnFile.h"
+
+  // Standard C++ library header files
+
+#include <array>
+#include <fstream>
+#include <system_error>
+
+namespace MCL
+{
+  namespace
+  {
+    char constexpr MAGIC[8] = { 'M', 'C', 'L', 'C', 'O', 'L', 'M', 'N' };
+    std::size_t constexpr WRITE_BLOCK = 1 << 20;              ///< Bytes of values swapped per write on big-endian hosts.
+
+    /// @brief Stores an unsigned value as little-endian bytes.
+
+    template<typename T>
+    void storeLE(char *p, T value) noexcept
+    {
+      for (std::size_t index = 0; index < sizeof(T); index++)
+      {
+        p[index] = static_cast<char>((value >> (8 * index)) & 0xFF);
+      };
+    }
+
+    /// @brief Loads an unsigned value from little-endian bytes.
+
+    template<typename T>
+    T loadLE(char const *p) noexcept
+    {
+      T value = 0;
+
+      for (std::size_t index = 0; index < sizeof(T); index++)
+      {
+        value |= static_cast<T>(static_cast<unsigned char>(p[index])) << (8 * index);
+      };
+
+      return value;
+    }
+
+    /// @brief Returns the size of a value of the specified type. (0 for NT_none and invalid values.)
+
+    std::size_t elementSize(ENumericType type) noexcept
+    {
+      switch (type)
+      {
+        case NT_uint8:
+        case NT_int8:
+        {
+          return 1;
+        };
+        case NT_uint16:
+        case NT_int16:
+        {
+          return 2;
+        };
+        case NT_uint32:
+        case NT_int32:
+        case NT_float:
+        {
+          return 4;
+        };
+        case NT_uint64:
+        case NT_int64:
+        case NT_double:
+        {
+          return 8;
+        };
+        default:
+        {
+          return 0;
+        };
+      };
+    }
+
+    /// @brief Returns the offset of the footer. (The first multiple of 8 after the values.)
+
+    constexpr std::uint64_t footerOffset(std::uint64_t count, std::uint64_t elementSize) noexcept
+    {
+      return (detail::COLUMNFILE_HEADER + count * elementSize + 7) & ~std::uint64_t{7};
+    }
+  }
+
+  namespace detail
+  {
+    /// @brief      Reverses the bytes of each element of an array.
+    /// @param[in]  data: The array.
+    /// @param[in]  count: The number of elements.
+    /// @param[in]  size: The size of an element.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    void byteSwap(char *data, std::size_t count, std::size_t size) noexcept
+    {
+      for (std::size_t index = 0; index < count; index++)
+      {
+        std::reverse(data + index * size, data + (index + 1) * size);
+      };
+    }
+
+    /// @brief      Writes the header, values and footer of a column file.
+    /// @param[in]  path: The file to write.
+    /// @param[in]  type: The type of the values.
+    /// @param[in]  size: The size of a value.
+    /// @param[in]  data: The values. (In the byte order of the host.)
+    /// @param[in]  count: The number of values.
+    /// @param[in]  chunkSize: The number of values per chunk.
+    /// @param[in]  summaries: The summary of each chunk.
+    /// @throws     std::system_error - The file cannot be written.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-19/GGB - Function created.
+
+    void columnFileWrite(std::filesystem::path const &path, ENumericType type, std::size_t size, char const *data,
+                         std::size_t count, std::size_t chunkSize, std::span<summary_t const> summaries)
+    {
+      std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+
+      if (!ofs)
+      {
+        throw std::system_error(std::make_error_code(std::errc::io_error),
+                                "MCL::columnFileWrite - Unable to open " + path.string());
+      };
+
+      std::uint64_t footer = footerOffset(count, size);
+      std::array<char, COLUMNFILE_HEADER> header = {};
+
+      std::copy(std::begin(MAGIC), std::end(MAGIC), header.begin());
+      storeLE(header.data() + 8, COLUMNFILE_VERSION);
+      storeLE(header.data() + 10, static_cast<std::uint16_t>(static_cast<std::int16_t>(type)));
+      storeLE(header.data() + 12, static_cast<std::uint32_t>(size));
+      storeLE(header.data() + 16, static_cast<std::uint64_t>(chunkSize));
+      storeLE(header.data() + 24, static_cast<std::uint64_t>(count));
+      storeLE(header.data() + 32, footer);
+      ofs.write(header.data(), header.size());
+
+      if constexpr (std::endian::native == std::endian::little)
+      {
+        ofs.write(data, static_cast<std::streamsize>(count * size));
+      }
+      else
+      {
+        std::vector<char> buffer(WRITE_BLOCK);
+        std::size_t blockCount = WRITE_BLOCK / size;
+
+        for (std::size_t index = 0; index < count; index += blockCount)
+        {
+          std::size_t n = std::min(blockCount, count - index);
+
+          std::copy(data + index * size, data + (index + n) * size, buffer.data());
+          byteSwap(buffer.data(), n, size);
+          ofs.write(buffer.data(), static_cast<std::streamsize>(n * size));
+        };
+      };
+
+      std::array<char, 8> padding = {};
+      ofs.write(padding.data(), static_cast<std::streamsize>(footer - COLUMNFILE_HEADER - count * size));
+
+      std::vector<char> entries(summaries.size() * COLUMNFILE_FOOTER);
+      char *p = entries.data();
+
+      for (summary_t const &summary : summaries)
+      {
+        storeLE(p, summary.count());
+        storeLE(p + 8, std::bit_cast<std::uint64_t>(summary.sum()));
+        storeLE(p + 16, std::bit_cast<std::uint64_t>(summary.M2()));
+        storeLE(p + 24, std::bit_cast<std::uint64_t>(summary.min()));
+        storeLE(p + 32, std::bit_cast<std::uint64_t>(summary.max()));
+        p += COLUMNFILE_FOOTER;
+      };
+      ofs.write(entries.data(), static_cast<std::streamsize>(entries.size()));
+
+      if (!ofs.flush())
+      {
+        throw std::system_error(std::make_error_code(std::errc::io_error),
+                                "MCL::columnFileWrite - Unable to write " + path.string());
+      };
+    }
+  }
+
+  /// @brief      Opens a column file and reads the header and footer.
+  /// @param[in]  path: The file to open.
+  /// @throws     std::system_error - The file cannot be opened.
+  /// @throws     std::runtime_error - The file is not a column file, is a later version or is truncated.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  columnFile_t::columnFile_t(std::filesystem::path const &path) : file_(path)
+  {
+    std::span<char const> data = file_.data();
+
+    if ( (data.size() < detail::COLUMNFILE_HEADER) || !std::equal(std::begin(MAGIC), std::end(MAGIC), data.begin()) )
+    {
+      throw std::runtime_error("MCL::columnFile_t - Not a column file: " + path.string());
+    };
+
+    if (loadLE<std::uint16_t>(data.data() + 8) > COLUMNFILE_VERSION)
+    {
+      throw std::runtime_error("MCL::columnFile_t - Unsupported version: " + path.string());
+    };
+
+    type_ = static_cast<ENumericType>(static_cast<std::int16_t>(loadLE<std::uint16_t>(data.data() + 10)));
+    elementSize_ = loadLE<std::uint32_t>(data.data() + 12);
+    chunkSize_ = loadLE<std::uint64_t>(data.data() + 16);
+    count_ = loadLE<std::uint64_t>(data.data() + 24);
+
+    std::uint64_t footer = loadLE<std::uint64_t>(data.data() + 32);
+    std::size_t chunkCount = (chunkSize_ == 0) ? 0 : count_ / chunkSize_ + (count_ % chunkSize_ != 0);
+
+    if ( (elementSize_ == 0) || (elementSize(type_) != elementSize_) || ((count_ != 0) && (chunkCount == 0)) ||
+         (count_ > (data.size() / elementSize_)) || (footer != footerOffset(count_, elementSize_)) ||
+         (data.size() < footer + chunkCount * detail::COLUMNFILE_FOOTER) )
+    {
+      throw std::runtime_error("MCL::columnFile_t - Invalid or truncated file: " + path.string());
+    };
+
+    summaries_.reserve(chunkCount);
+    for (char const *p = data.data() + footer; summaries_.size() < chunkCount; p += detail::COLUMNFILE_FOOTER)
+    {
+      summaries_.emplace_back(loadLE<std::uint64_t>(p),
+                              std::bit_cast<double>(loadLE<std::uint64_t>(p + 8)),
+                              std::bit_cast<double>(loadLE<std::uint64_t>(p + 16)),
+                              std::bit_cast<double>(loadLE<std::uint64_t>(p + 24)),
+                              std::bit_cast<double>(loadLE<std::uint64_t>(p + 32)));
+    };
+  }
+
+  /// @brief      Checks a chunk number.
+  /// @param[in]  chunk: The chunk number.
+  /// @throws     std::out_of_range
+  /// @version    2026-10-19/GGB - Function created.
+
+  void columnFile_t::checkChunk(std::size_t chunk) const
+  {
+    if (chunk >= summaries_.size())
+    {
+      throw std::out_of_range("MCL::columnFile_t - Invalid chunk number.");
+    };
+  }
+
+  /// @brief      Returns the number of values in a chunk.
+  /// @param[in]  chunk: The chunk number.
+  /// @returns    The number of values. (chunkSize() for all but the last chunk.)
+  /// @throws     std::out_of_range - Invalid chunk number.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::size_t columnFile_t::chunkLength(std::size_t chunk) const
+  {
+    checkChunk(chunk);
+
+    return std::min(chunkSize_, count_ - chunk * chunkSize_);
+  }
+
+  /// @brief      Returns the stored summary of a chunk.
+  /// @param[in]  chunk: The chunk number.
+  /// @returns    The summary.
+  /// @throws     std::out_of_range - Invalid chunk number.
+  /// @version    2026-10-19/GGB - Function created.
+
+  summary_t const &columnFile_t::summary(std::size_t chunk) const
+  {
+    checkChunk(chunk);
+
+    return summaries_[chunk];
+  }
+
+  /// @brief      Returns the summary of a range of chunks. The values are not read.
+  /// @param[in]  first: The first chunk.
+  /// @param[in]  last: One past the last chunk.
+  /// @returns    The merged summary.
+  /// @throws     std::out_of_range - Invalid range.
+  /// @version    2026-10-19/GGB - Function created.
+
+  summary_t columnFile_t::summary(std::size_t first, std::size_t last) const
+  {
+    if ( (first > last) || (last > summaries_.size()) )
+    {
+      throw std::out_of_range("MCL::columnFile_t - Invalid chunk range.");
+    };
+
+    summary_t result;
+
+    for (std::size_t chunk = first; chunk < last; chunk++)
+    {
+      result.merge(summaries_[chunk]);
+    };
+
+    return result;
+  }
+
+}   // namespace MCL
@@ -0,0 +1,171 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								mappedFile
+// SUBSYSTEM:						Input/Output
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A read only view of a file.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/io/mappedFile.h"
+
+  // Standard C++ library header files
+
+#include <cerrno>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MCL_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MCL
+{
+  /// @brief      Opens and maps a file.
+  /// @param[in]  path: The file to open.
+  /// @throws     std::system_error - The file cannot be opened or mapped.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  mappedFile_t::mappedFile_t(std::filesystem::path const &path)
+  {
+#ifdef MCL_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+      throw std::system_error(errno, std::generic_category(), "MCL::mappedFile_t - Unable to open " + path.string());
+    };
+
+    struct stat fileStatus;
+
+    if (::fstat(fd, &fileStatus) != 0)
+    {
+      int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), "MCL::mappedFile_t - Unable to read " + path.string());
+    };
+
+    size_ = static_cast<std::size_t>(fileStatus.st_size);
+
+    if (size_ != 0)
+    {
+      void *address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (address == MAP_FAILED)
+      {
+        int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "MCL::mappedFile_t - Unable to map " + path.string());
+      };
+
+      ::madvise(address, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<char const *>(address);
+      mapped_ = true;
+    };
+
+    ::close(fd);      // The mapping remains valid after the descriptor is closed.
+#else
+    std::ifstream ifs(path, std::ios::binary);
+
+    if (!ifs)
+    {
+      throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory),
+                              "MCL::mappedFile_t - Unable to open " + path.string());
+    };
+
+    buffer_.resize(static_cast<std::size_t>(std::filesystem::file_size(path)));
+    ifs.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+  }
+
+  /// @brief      Move constructor.
+  /// @param[in]  other: The file to move from. Left empty.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  mappedFile_t::mappedFile_t(mappedFile_t &&other) noexcept
+  {
+    *this = std::move(other);
+  }
+
+  /// @brief      Unmaps the file.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  mappedFile_t::~mappedFile_t()
+  {
+    release();
+  }
+
+  /// @brief      Move assignment.
+  /// @param[in]  other: The file to move from. Left empty.
+  /// @returns    *this
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  mappedFile_t &mappedFile_t::operator=(mappedFile_t &&other) noexcept
+  {
+    if (this != &other)
+    {
+      release();
+
+      mapped_ = std::exchange(other.mapped_, false);
+      size_ = std::exchange(other.size_, 0);
+      buffer_ = std::move(other.buffer_);
+      data_ = mapped_ ? std::exchange(other.data_, nullptr) : buffer_.data();
+      other.data_ = nullptr;
+    };
+
+    return *this;
+  }
+
+  /// @brief      Releases the mapping or buffer.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void mappedFile_t::release() noexcept
+  {
+#ifdef MCL_MMAP
+    if (mapped_)
+    {
+      ::munmap(const_cast<char *>(data_), size_);
+    };
+#endif
+    mapped_ = false;
+    data_ = nullptr;
+    size_ = 0;
+    buffer_.clear();
+  }
+
+}   // namespace MCL
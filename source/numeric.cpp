@@ -10,7 +10,7 @@
 // AUTHOR:							Gavin Blakeman.
 // LICENSE:             GPLv2
 //
-//                      Copyright 2015, 2017-2020 Gavin Blakeman.
+//                      Copyright 2015, 2017-2020, 2026 Gavin Blakeman.
 //                      This file is part of the Maths Class Library (MCL)
 //
 //                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
@@ -26,13 +26,19 @@
 //
 // OVERVIEW:            The CNumeric class provides a class with a type that can be selected on the fly.
 //
-// HISTORY:             2015-09-22 GGB - astroManager 2015.09 release
+// HISTORY:             2026-10-19 GGB - Conversions are driven from a conversion matrix rather than nested switches.
+//                      2015-09-22 GGB - astroManager 2015.09 release
 //                      2015-07-07 GGB - File Created.
 //
 //**********************************************************************************************************************************
 
 #include "include/numeric.h"
 
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <array>
+
   // MCL Includes
 
 #include "include/exceptions.h"
@@ -43,6 +49,40 @@
 
 namespace MCL
 {
+  namespace
+  {
+    std::size_t constexpr TYPE_COUNT = 11;      ///< Number of ENumericType values, including NT_none.
+
+    /// @brief Maps the (sparse) ENumericType values onto a dense index [0; TYPE_COUNT) that is used to index the conversion
+    ///        matrix. Unknown values map to the index of NT_none.
+
+    std::array<std::uint8_t, 129> constexpr typeIndexTable = []()
+    {
+      std::array<std::uint8_t, 129> table = { };
+      ENumericType constexpr types[TYPE_COUNT] = { NT_none, NT_uint8, NT_uint16, NT_uint32, NT_uint64, NT_int8, NT_int16,
+                                                   NT_int32, NT_int64, NT_float, NT_double };
+
+      for (std::uint8_t index = 0; index < TYPE_COUNT; index++)
+      {
+        table[static_cast<int>(types[index]) + 64] = index;
+      };
+
+      return table;
+    }();
+
+    /// @brief      Returns the dense index of a numeric type.
+    /// @param[in]  type: The numeric type.
+    /// @returns    The index into the conversion matrix.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    inline std::size_t typeIndex(ENumericType type) noexcept
+    {
+      int index = static_cast<int>(type) + 64;
+
+      return (index >= 0 && index < static_cast<int>(typeIndexTable.size())) ? typeIndexTable[index] : 0;
+    }
+  }
 
   /// @brief Default constructor
   /// @throws None.
@@ -143,1240 +183,275 @@ namespace MCL
     value.doubleValue = v;
   }
 
-  /// @brief Returns the value as an 8 bit unsigned integer
-  /// @returns The stored value as std::uint8_t
-  /// @throws 0x1000 - NUMERIC: Value out of range.
+
+  //********************************************************************************************************************************
+  //
+  // Conversions
   //
-  // 2015-07-08/GGB - Function created.
+  //********************************************************************************************************************************
 
-  CNumeric::operator std::uint8_t() const
+  /// @brief      Converts the stored value to the type D without throwing. The conversion is selected from a conversion matrix
+  ///             that is generated for each destination type, indexed by the stored type.
+  /// @param[out] d: The converted value. Set to zero if the value is out of range.
+  /// @returns    CS_OK, CS_RANGE or CS_NOVALUE.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename D>
+  conversionStatus_e CNumeric::convert(D &d) const noexcept
   {
-    std::uint8_t returnValue;
+    using function_t = conversionStatus_e (*)(UValue const &, D &) noexcept;
 
-    switch (storedType)
+    static constexpr function_t matrix[TYPE_COUNT] =
     {
-      case NT_uint8:
-      {
-        returnValue = value.uint8Value;
-        break;
-      };
-      case NT_uint16:
-      {
-        if (value.uint16Value > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.uint16Value);
-        };
-        break;
-      };
-      case NT_uint32:
-      {
-        if (value.uint32Value > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.uint32Value);
-        };
-        break;
-      };
-      case NT_uint64:
-      {
-        if (value.uint64Value > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.uint64Value);
-        };
-        break;
-      };
-      case NT_int8:
-      {
-        if (value.int8Value < std::numeric_limits<std::uint8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int8Value > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.int8Value);
-        };
-        break;
-      };
-      case NT_int16:
-      {
-        if (value.int16Value < std::numeric_limits<std::uint8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int16Value > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.int16Value);
-        };
-        break;
-      };
-      case NT_int32:
-      {
-        if (value.int32Value < std::numeric_limits<std::uint8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int32Value > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.int32Value);
-        };
-        break;
-      };
-      case NT_int64:
-      {
-        if (value.int64Value < std::numeric_limits<std::uint8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int64Value > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.int64Value);
-        };
-        break;
-      };
-      case NT_float:
+      [](UValue const &, D &d) noexcept { d = D{0}; return CS_NOVALUE; },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.uint8Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.uint16Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.uint32Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.uint64Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.int8Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.int16Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.int32Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.int64Value, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.floatValue, d); },
+      [](UValue const &v, D &d) noexcept { return numericConvert(v.doubleValue, d); },
+    };
+
+    return matrix[typeIndex(storedType)](value, d);
+  }
+
+  /// @brief      Returns the stored value converted to the type D.
+  /// @returns    The converted value.
+  /// @throws     0x1000 - NUMERIC: Value out of range.
+  /// @throws     GCL::CCodeError(MCL) - No value stored.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename D>
+  D CNumeric::checkedValue() const
+  {
+    D returnValue;
+
+    switch (convert(returnValue))
+    {
+      case CS_OK:
       {
-        if (value.floatValue < std::numeric_limits<std::uint8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.floatValue);
-        };
         break;
       };
-      case NT_double:
+      case CS_RANGE:
       {
-        if (value.doubleValue < std::numeric_limits<std::uint8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::uint8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint8_t>(value.doubleValue);
-        };
+        ERRORMESSAGE("NUMERIC: Value out of range.");
         break;
       };
-      case NT_none:
+      case CS_NOVALUE:
       default:
       {
         CODE_ERROR();
         break;
       };
-    }
+    };
 
     return returnValue;
   }
 
+  /// @brief      Converts an array of values to the type D. If all the values have the same stored type, the conversion is
+  ///             selected once and the values are converted in a single loop. Otherwise each value is converted through the
+  ///             conversion matrix.
+  /// @param[in]  src: The values to convert.
+  /// @param[out] dest: The converted values. Values that cannot be converted are set to zero.
+  /// @returns    The status of all the conversions combined. (CS_OK if all the values converted.)
+  /// @throws     None.
+  /// @note       If dest is smaller than src, only dest.size() values are converted.
+  /// @version    2026-10-19/GGB - Function created.
+
+  template<typename D>
+  conversionStatus_e convert(std::span<CNumeric const> src, std::span<D> dest) noexcept
+  {
+    using bulkFunction_t = int (*)(std::span<CNumeric const>, std::span<D>) noexcept;
+
+    static constexpr bulkFunction_t matrix[TYPE_COUNT] =
+    {
+      [](std::span<CNumeric const> s, std::span<D> d) noexcept
+      {
+        std::fill(d.begin(), d.end(), D{0});
+        return s.empty() ? static_cast<int>(CS_OK) : static_cast<int>(CS_NOVALUE);
+      },
+#define MCL_BULK_CONVERT(member) \
+      [](std::span<CNumeric const> s, std::span<D> d) noexcept \
+      { \
+        int status = CS_OK; \
+        for (std::size_t index = 0; index < d.size(); index++) \
+        { \
+          status |= numericConvert(s[index].value.member, d[index]); \
+        }; \
+        return status; \
+      }
+      MCL_BULK_CONVERT(uint8Value),
+      MCL_BULK_CONVERT(uint16Value),
+      MCL_BULK_CONVERT(uint32Value),
+      MCL_BULK_CONVERT(uint64Value),
+      MCL_BULK_CONVERT(int8Value),
+      MCL_BULK_CONVERT(int16Value),
+      MCL_BULK_CONVERT(int32Value),
+      MCL_BULK_CONVERT(int64Value),
+      MCL_BULK_CONVERT(floatValue),
+      MCL_BULK_CONVERT(doubleValue),
+#undef MCL_BULK_CONVERT
+    };
+
+    std::size_t count = std::min(src.size(), dest.size());
+    bool homogeneous = true;
+    int status = CS_OK;
+
+    for (std::size_t index = 1; index < count; index++)
+    {
+      homogeneous &= (src[index].storedType == src[0].storedType);
+    };
+
+    if (count == 0)
+    {
+    }
+    else if (homogeneous)
+    {
+      status = matrix[typeIndex(src[0].storedType)](src.first(count), dest.first(count));
+    }
+    else
+    {
+      for (std::size_t index = 0; index < count; index++)
+      {
+        status |= src[index].convert(dest[index]);
+      };
+    };
+
+    return static_cast<conversionStatus_e>(status);
+  }
+
+  /// @brief Returns the value as an 8 bit unsigned integer
+  /// @returns The stored value as std::uint8_t
+  /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
+  /// @version 2015-07-08/GGB - Function created.
+
+  CNumeric::operator std::uint8_t() const
+  {
+    return checkedValue<std::uint8_t>();
+  }
+
   /// @brief Returns the value as an 16 bit unsigned integer
   /// @returns The stored value as std::uint16_t
   /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
   /// @version 2015-07-08/GGB - Function created.
 
   CNumeric::operator std::uint16_t() const
   {
-    std::uint16_t returnValue;
-
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = static_cast<std::uint16_t>(value.uint8Value);
-        break;
-      };
-      case NT_uint16:
-      {
-        returnValue = value.uint16Value;
-        break;
-      };
-      case NT_uint32:
-      {
-        if (value.uint32Value > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.uint32Value);
-        };
-        break;
-      };
-      case NT_uint64:
-      {
-        if (value.uint64Value > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.uint64Value);
-        };
-        break;
-      };
-      case NT_int8:
-      {
-        if (value.int8Value < std::numeric_limits<std::uint16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int8Value > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.int8Value);
-        };
-        break;
-      };
-      case NT_int16:
-      {
-        if (value.int16Value < std::numeric_limits<std::uint16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int16Value > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.int16Value);
-        };
-        break;
-      };
-      case NT_int32:
-      {
-        if (value.int32Value < std::numeric_limits<std::uint16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int32Value > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.int32Value);
-        };
-        break;
-      };
-      case NT_int64:
-      {
-        if (value.int64Value < std::numeric_limits<std::uint16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int64Value > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.int64Value);
-        };
-        break;
-      };
-      case NT_float:
-      {
-        if (value.floatValue < std::numeric_limits<std::uint16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.floatValue);
-        };
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<std::uint16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::uint16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint16_t>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<std::uint16_t>();
   }
 
   /// @brief Returns the value as an 32 bit unsigned integer
   /// @returns The stored value as std::uint32_t
   /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
   /// @version 2015-07-08/GGB - Function created.
 
-  CNumeric::operator uint32_t() const
+  CNumeric::operator std::uint32_t() const
   {
-    std::uint32_t returnValue;
-
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = value.uint8Value;
-        break;
-      };
-      case NT_uint16:
-      {
-        returnValue = value.uint16Value;
-        break;
-      };
-      case NT_uint32:
-      {
-        returnValue = value.uint32Value;
-        break;
-      };
-      case NT_uint64:
-      {
-        if (value.uint64Value > std::numeric_limits<std::uint32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint32_t>(value.uint64Value);
-        };
-        break;
-      };
-      case NT_int8:
-      {
-        if (value.int8Value < 0)
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint32_t>(value.int8Value);
-        };
-        break;
-      };
-      case NT_int16:
-      {
-        if (value.int16Value < 0)
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint32_t>(value.int16Value);
-        };
-        break;
-      };
-      case NT_int32:
-      {
-        if (value.int32Value < 0)
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint32_t>(value.int32Value);
-        };
-        break;
-      };
-      case NT_int64:
-      {
-        if (value.int64Value < std::numeric_limits<std::uint32_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int64Value > std::numeric_limits<std::uint32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint32_t>(value.int64Value);
-        };
-        break;
-      };
-      case NT_float:
-      {
-        if (value.floatValue < std::numeric_limits<std::uint32_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::uint32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint32_t>(value.floatValue);
-        };
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<std::uint32_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::uint32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint32_t>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<std::uint32_t>();
   }
 
   /// @brief Returns the value as an 64 bit unsigned integer
   /// @returns The stored value as std::uint64_t
   /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
   /// @version 2015-07-08/GGB - Function created.
 
-  CNumeric::operator uint64_t() const
+  CNumeric::operator std::uint64_t() const
   {
-    std::uint64_t returnValue;
-
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = value.uint8Value;
-        break;
-      };
-      case NT_uint16:
-      {
-        returnValue = value.uint16Value;
-        break;
-      };
-      case NT_uint32:
-      {
-        returnValue = value.uint32Value;
-        break;
-      };
-      case NT_uint64:
-      {
-        returnValue = value.uint64Value;
-        break;
-      };
-      case NT_int8:
-      {
-        if (value.int8Value < 0)
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint64_t>(value.int8Value);
-        };
-        break;
-      };
-      case NT_int16:
-      {
-        if (value.int16Value < 0)
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint64_t>(value.int16Value);
-        };
-        break;
-      };
-      case NT_int32:
-      {
-        if (value.int32Value < 0)
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint64_t>(value.int32Value);
-        };
-        break;
-      };
-      case NT_int64:
-      {
-        if (value.int64Value < 0)
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint64_t>(value.int64Value);
-        };
-        break;
-      };
-      case NT_float:
-      {
-        if (value.floatValue < std::numeric_limits<std::uint64_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::uint64_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint64_t>(value.floatValue);
-        };
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<std::uint64_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::uint64_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::uint64_t>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<std::uint64_t>();
   }
 
-  /// @brief Returns the value as an 8 bit integer
+  /// @brief Returns the value as an 8 bit signed integer
   /// @returns The stored value as std::int8_t
   /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
   /// @version 2015-07-08/GGB - Function created.
 
-  CNumeric::operator int8_t() const
+  CNumeric::operator std::int8_t() const
   {
-    std::int8_t returnValue;
-
-    switch (storedType)
-    {
-      case NT_int8:
-      {
-        returnValue = value.int8Value;
-        break;
-      };
-      case NT_uint8:
-      {
-        if (value.uint8Value > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.uint8Value);
-        }
-        break;
-      };
-      case NT_uint16:
-      {
-        if (value.uint16Value > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.uint16Value);
-        };
-        break;
-      };
-      case NT_uint32:
-      {
-        if (value.uint32Value > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.uint32Value);
-        };
-        break;
-      };
-      case NT_uint64:
-      {
-        if (value.uint64Value > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.uint64Value);
-        };
-        break;
-      };
-      case NT_int16:
-      {
-        if (value.int16Value < std::numeric_limits<std::int8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int16Value > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.int16Value);
-        };
-        break;
-      };
-      case NT_int32:
-      {
-        if (value.int32Value < std::numeric_limits<std::int8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int32Value > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.int32Value);
-        };
-        break;
-      };
-      case NT_int64:
-      {
-        if (value.int64Value < std::numeric_limits<std::int8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int64Value > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.int64Value);
-        };
-        break;
-      };
-      case NT_float:
-      {
-        if (value.floatValue < std::numeric_limits<std::int8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.floatValue);
-        };
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<std::int8_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::int8_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int8_t>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<std::int8_t>();
   }
 
-  /// @brief Returns the value as an 16 bit integer
+  /// @brief Returns the value as an 16 bit signed integer
   /// @returns The stored value as std::int16_t
   /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
   /// @version 2015-07-08/GGB - Function created.
 
   CNumeric::operator std::int16_t() const
   {
-    std::int16_t returnValue;
-
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = static_cast<std::int16_t>(value.uint8Value);
-        break;
-      };
-      case NT_uint16:
-      {
-        if (value.uint16Value > std::numeric_limits<std::int16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int16_t>(value.uint16Value);
-        };
-        break;
-      };
-      case NT_uint32:
-      {
-        if (value.uint32Value > std::numeric_limits<std::int16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int16_t>(value.uint32Value);
-        };
-        break;
-      };
-      case NT_uint64:
-      {
-        if (value.uint64Value > std::numeric_limits<std::int16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int16_t>(value.uint64Value);
-        };
-        break;
-      };
-      case NT_int8:
-      {
-        returnValue = value.int8Value;
-        break;
-      };
-      case NT_int16:
-      {
-        returnValue = value.int16Value;
-        break;
-      };
-      case NT_int32:
-      {
-        if (value.int32Value < std::numeric_limits<std::int16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int32Value > std::numeric_limits<std::int16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int16_t>(value.int32Value);
-        };
-        break;
-      };
-      case NT_int64:
-      {
-        if (value.int64Value < std::numeric_limits<std::int16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int64Value > std::numeric_limits<std::int16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int16_t>(value.int64Value);
-        };
-        break;
-      };
-      case NT_float:
-      {
-        if (value.floatValue < std::numeric_limits<std::int16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::int16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int16_t>(value.floatValue);
-        };
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<std::int16_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::int16_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int16_t>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<std::int16_t>();
   }
 
-  /// @brief Returns the value as an 32 bit integer
+  /// @brief Returns the value as an 32 bit signed integer
   /// @returns The stored value as std::int32_t
   /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
   /// @version 2015-07-08/GGB - Function created.
 
   CNumeric::operator std::int32_t() const
   {
-    std::int32_t returnValue;
-
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = static_cast<std::int32_t>(value.uint8Value);
-        break;
-      };
-      case NT_uint16:
-      {
-        returnValue = static_cast<std::int32_t>(value.uint16Value);
-        break;
-      };
-      case NT_uint32:
-      {
-        if (value.uint32Value > std::numeric_limits<std::int32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int32_t>(value.uint32Value);
-        };
-        break;
-      };
-      case NT_uint64:
-      {
-        if (value.uint64Value > std::numeric_limits<std::int32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int32_t>(value.uint64Value);
-        };
-        break;
-      };
-      case NT_int8:
-      {
-        returnValue = value.int8Value;
-        break;
-      };
-      case NT_int16:
-      {
-        returnValue = value.int16Value;
-        break;
-      };
-      case NT_int32:
-      {
-        returnValue = value.int32Value;
-        break;
-      };
-      case NT_int64:
-      {
-        if (value.int64Value < std::numeric_limits<std::int32_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.int64Value > std::numeric_limits<std::int32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int32_t>(value.int64Value);
-        };
-        break;
-      };
-      case NT_float:
-      {
-        if (value.floatValue < std::numeric_limits<std::int32_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::int32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int32_t>(value.floatValue);
-        };
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<std::int32_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::int32_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int32_t>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<std::int32_t>();
   }
 
-  /// @brief Returns the value as an 64 bit integer
+  /// @brief Returns the value as an 64 bit signed integer
   /// @returns The stored value as std::int64_t
   /// @throws 0x1000 - NUMERIC: Value out of range.
+  /// @version 2026-10-19/GGB - Use the conversion matrix.
   /// @version 2015-07-08/GGB - Function created.
 
   CNumeric::operator std::int64_t() const
   {
-    std::int64_t returnValue;
-
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = static_cast<std::int64_t>(value.uint8Value);
-        break;
-      };
-      case NT_uint16:
-      {
-        returnValue = static_cast<std::int64_t>(value.uint16Value);
-        break;
-      };
-      case NT_uint32:
-      {
-        returnValue = static_cast<std::int64_t>(value.uint32Value);
-        break;
-      };
-      case NT_uint64:
-      {
-        if (value.uint64Value > std::numeric_limits<std::int64_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int64_t>(value.uint64Value);
-        };
-        break;
-      };
-      case NT_int8:
-      {
-        returnValue = value.int8Value;
-        break;
-      };
-      case NT_int16:
-      {
-        returnValue = value.int16Value;
-        break;
-      };
-      case NT_int32:
-      {
-        returnValue = value.int32Value;
-        break;
-      };
-      case NT_int64:
-      {
-        returnValue = value.int64Value;
-        break;
-      };
-      case NT_float:
-      {
-        if (value.floatValue < std::numeric_limits<std::int64_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.floatValue > std::numeric_limits<std::int64_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int64_t>(value.floatValue);
-        };
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<std::int64_t>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<std::int64_t>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<std::int64_t>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<std::int64_t>();
   }
 
-  /// @brief Returns the value as an float value
+  /// @brief Returns the value as a float value
   /// @returns The stored value as a float
   /// @throws 0x1000 - NUMERIC: Value out of range.
-  //
-  // 2015-07-08/GGB - Function created.
+  /// @version 2026-10-19/GGB - Use the conversion matrix. (Negative double values are no longer out of range.)
+  /// @version 2015-07-08/GGB - Function created.
 
   CNumeric::operator float() const
   {
-    float returnValue;
-
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = value.uint8Value;
-        break;
-      };
-      case NT_uint16:
-      {
-        returnValue = value.uint16Value;
-        break;
-      };
-      case NT_uint32:
-      {
-        returnValue = value.uint32Value;
-        break;
-      };
-      case NT_uint64:
-      {
-        returnValue = value.uint64Value;
-        break;
-      };
-      case NT_int8:
-      {
-        returnValue = value.int8Value;
-        break;
-      };
-      case NT_int16:
-      {
-        returnValue = value.int16Value;
-        break;
-      };
-      case NT_int32:
-      {
-        returnValue = value.int32Value;
-        break;
-      };
-      case NT_int64:
-      {
-        returnValue = value.int64Value;
-        break;
-      };
-      case NT_float:
-      {
-        returnValue = value.floatValue;
-        break;
-      };
-      case NT_double:
-      {
-        if (value.doubleValue < std::numeric_limits<float>::min())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else if (value.doubleValue > std::numeric_limits<float>::max())
-        {
-          ERRORMESSAGE("NUMERIC: Value out of range.");
-        }
-        else
-        {
-          returnValue = static_cast<float>(value.doubleValue);
-        };
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
-
-    return returnValue;
+    return checkedValue<float>();
   }
 
   /// @brief Returns the value as an double value
   /// @returns The stored value as a double
   /// @throws 0x1000 - NUMERIC: Value out of range.
-  //
-  // 2015-07-08/GGB - Function created.
+  /// @version 2026-10-19/GGB - Use the conversion matrix. (Double values are no longer rounded through float.)
+  /// @version 2015-07-08/GGB - Function created.
 
   CNumeric::operator double() const
   {
-    double returnValue;
+    return checkedValue<double>();
+  }
 
-    switch (storedType)
-    {
-      case NT_uint8:
-      {
-        returnValue = value.uint8Value;
-        break;
-      };
-      case NT_uint16:
-      {
-        returnValue = value.uint16Value;
-        break;
-      };
-      case NT_uint32:
-      {
-        returnValue = value.uint32Value;
-        break;
-      };
-      case NT_uint64:
-      {
-        returnValue = value.uint64Value;
-        break;
-      };
-      case NT_int8:
-      {
-        returnValue = value.int8Value;
-        break;
-      };
-      case NT_int16:
-      {
-        returnValue = value.int16Value;
-        break;
-      };
-      case NT_int32:
-      {
-        returnValue = value.int32Value;
-        break;
-      };
-      case NT_int64:
-      {
-        returnValue = value.int64Value;
-        break;
-      };
-      case NT_float:
-      {
-        returnValue = value.floatValue;
-        break;
-      };
-      case NT_double:
-      {
-        returnValue = static_cast<float>(value.doubleValue);
-        break;
-      };
-      case NT_none:
-      default:
-      {
-        CODE_ERROR();
-        break;
-      };
-    }
+    // Explicit instantiation of the conversions for the supported types.
 
-    return returnValue;
-  }
+#define MCL_NUMERIC_INSTANTIATE(type) \
+  template conversionStatus_e CNumeric::convert<type>(type &) const noexcept; \
+  template conversionStatus_e convert<type>(std::span<CNumeric const>, std::span<type>) noexcept;
+
+  MCL_NUMERIC_INSTANTIATE(std::uint8_t)
+  MCL_NUMERIC_INSTANTIATE(std::uint16_t)
+  MCL_NUMERIC_INSTANTIATE(std::uint32_t)
+  MCL_NUMERIC_INSTANTIATE(std::uint64_t)
+  MCL_NUMERIC_INSTANTIATE(std::int8_t)
+  MCL_NUMERIC_INSTANTIATE(std::int16_t)
+  MCL_NUMERIC_INSTANTIATE(std::int32_t)
+  MCL_NUMERIC_INSTANTIATE(std::int64_t)
+  MCL_NUMERIC_INSTANTIATE(float)
+  MCL_NUMERIC_INSTANTIATE(double)
+
+#undef MCL_NUMERIC_INSTANTIATE
 
 } // namespace MCL
@@ -0,0 +1,275 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								numericColumn
+// SUBSYSTEM:						Numeric classes.
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            The numericColumn_t class is the bulk counterpart of CNumeric.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/numericColumn.h"
+
+namespace MCL
+{
+  /// @brief      Constructs a column of the specified type.
+  /// @param[in]  type: The type of the values stored in the column. NT_none creates a column with no type.
+  /// @param[in]  size: The number of values. The values are initialised to zero.
+  /// @throws     std::invalid_argument - Invalid type.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  numericColumn_t::numericColumn_t(ENumericType type, std::size_t size)
+  {
+    switch (type)
+    {
+      case NT_none:
+      {
+        break;
+      };
+      case NT_uint8:
+      {
+        storage.emplace<std::vector<std::uint8_t>>(size);
+        break;
+      };
+      case NT_uint16:
+      {
+        storage.emplace<std::vector<std::uint16_t>>(size);
+        break;
+      };
+      case NT_uint32:
+      {
+        storage.emplace<std::vector<std::uint32_t>>(size);
+        break;
+      };
+      case NT_uint64:
+      {
+        storage.emplace<std::vector<std::uint64_t>>(size);
+        break;
+      };
+      case NT_int8:
+      {
+        storage.emplace<std::vector<std::int8_t>>(size);
+        break;
+      };
+      case NT_int16:
+      {
+        storage.emplace<std::vector<std::int16_t>>(size);
+        break;
+      };
+      case NT_int32:
+      {
+        storage.emplace<std::vector<std::int32_t>>(size);
+        break;
+      };
+      case NT_int64:
+      {
+        storage.emplace<std::vector<std::int64_t>>(size);
+        break;
+      };
+      case NT_float:
+      {
+        storage.emplace<std::vector<float>>(size);
+        break;
+      };
+      case NT_double:
+      {
+        storage.emplace<std::vector<double>>(size);
+        break;
+      };
+      default:
+      {
+        throw std::invalid_argument("numericColumn_t: Invalid numeric type.");
+        break;
+      };
+    };
+  }
+
+  /// @brief      Returns the type of the values stored in the column.
+  /// @returns    The type of the column. NT_none if the column has no type.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  ENumericType numericColumn_t::type() const noexcept
+  {
+    return std::visit([](auto const &v)
+    {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+      {
+        return NT_none;
+      }
+      else
+      {
+        return numericType<typename std::decay_t<decltype(v)>::value_type>;
+      };
+    }, storage);
+  }
+
+  /// @brief      Returns the number of values stored in the column.
+  /// @returns    The number of values.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::size_t numericColumn_t::size() const noexcept
+  {
+    return std::visit([](auto const &v) -> std::size_t
+    {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+      {
+        return 0;
+      }
+      else
+      {
+        return v.size();
+      };
+    }, storage);
+  }
+
+  /// @brief      Returns the size (in bytes) of each value stored in the column.
+  /// @returns    The size of each value. Zero if the column has no type.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::size_t numericColumn_t::elementSize() const noexcept
+  {
+    return std::visit([](auto const &v) -> std::size_t
+    {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+      {
+        return 0;
+      }
+      else
+      {
+        return sizeof(typename std::decay_t<decltype(v)>::value_type);
+      };
+    }, storage);
+  }
+
+  /// @brief      Changes the number of values stored in the column. New values are initialised to zero.
+  /// @param[in]  newSize: The new number of values.
+  /// @throws     std::invalid_argument - The column has no type.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  void numericColumn_t::resize(std::size_t newSize)
+  {
+    std::visit([newSize](auto &v)
+    {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+      {
+        if (newSize != 0)
+        {
+          throw std::invalid_argument("numericColumn_t: Column has no type.");
+        };
+      }
+      else
+      {
+        v.resize(newSize);
+      };
+    }, storage);
+  }
+
+  /// @brief      Reserves storage for a number of values.
+  /// @param[in]  capacity: The number of values to reserve storage for.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  void numericColumn_t::reserve(std::size_t capacity)
+  {
+    std::visit([capacity](auto &v)
+    {
+      if constexpr (!std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+      {
+        v.reserve(capacity);
+      };
+    }, storage);
+  }
+
+  /// @brief      Removes all the values from the column. The type of the column is not changed.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void numericColumn_t::clear() noexcept
+  {
+    std::visit([](auto &v)
+    {
+      if constexpr (!std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+      {
+        v.clear();
+      };
+    }, storage);
+  }
+
+  /// @brief      Returns a single value from the column.
+  /// @param[in]  index: The index of the value.
+  /// @returns    The value.
+  /// @throws     std::out_of_range
+  /// @version    2026-10-19/GGB - Function created.
+
+  CNumeric numericColumn_t::at(std::size_t index) const
+  {
+    return std::visit([index](auto const &v) -> CNumeric
+    {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+      {
+        throw std::out_of_range("numericColumn_t: Index out of range.");
+      }
+      else
+      {
+        return CNumeric(v.at(index));
+      };
+    }, storage);
+  }
+
+  /// @brief      Converts the column into another column. The values are converted to the type of dest, which is resized to the
+  ///             size of this column. This is used to widen or narrow a column as a whole.
+  /// @param[out] dest: The destination column. The type of dest determines the type of the values.
+  /// @returns    The status of all the conversions combined. CS_NOVALUE if either column has no type. (dest is not changed.)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  conversionStatus_e numericColumn_t::convert(numericColumn_t &dest) const
+  {
+    if ( (type() == NT_none) || (dest.type() == NT_none) )
+    {
+      return CS_NOVALUE;
+    };
+
+    dest.resize(size());
+
+    return std::visit([this](auto &d)
+    {
+      if constexpr (std::is_same_v<std::decay_t<decltype(d)>, std::monostate>)
+      {
+        return CS_NOVALUE;
+      }
+      else
+      {
+        return convert(std::span(d));
+      };
+    }, dest.storage);
+  }
+
+} // namespace MCL
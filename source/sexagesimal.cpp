@@ -0,0 +1,375 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:							Maths Class Library
+// FILE:								sexagesimal
+// SUBSYSTEM:						Angle class
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman (GGB)
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+//
+// OVERVIEW:						Formatting and parsing of sexagesimal values.
+//
+// CLASSES INCLUDED:		None
+//
+// HISTORY:             2026-10-19 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#include "include/sexagesimal.h"
+
+  // Standard C++ library header files.
+
+#include <array>
+#include <cstdint>
+#include <system_error>
+
+namespace MCL
+{
+  namespace
+  {
+    std::array<std::uint64_t, SEXAGESIMAL_MAXPRECISION + 1> constexpr POWER10 =
+      { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+    double constexpr MAXTICKS = 9.0e18;                 ///< Limit of the number of ticks. (Less than 2^63.)
+
+    /// @brief      Writes a character.
+    /// @param[in]  first: The position to write to. (nullptr if an earlier write failed.)
+    /// @param[in]  last: The end of the buffer.
+    /// @param[in]  c: The character to write.
+    /// @returns    Pointer past the character, or nullptr if the buffer is too small.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    char *writeChar(char *first, char *last, char c) noexcept
+    {
+      if ((first == nullptr) || (first == last))
+      {
+        return nullptr;
+      };
+
+      *first++ = c;
+      return first;
+    }
+
+    /// @brief      Writes an unsigned integer with at least a minimum number of digits. (Leading zeros.)
+    /// @param[in]  first: The position to write to. (nullptr if an earlier write failed.)
+    /// @param[in]  last: The end of the buffer.
+    /// @param[in]  value: The value to write.
+    /// @param[in]  width: The minimum number of digits.
+    /// @returns    Pointer past the last digit, or nullptr if the buffer is too small.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    char *writeDigits(char *first, char *last, std::uint64_t value, int width) noexcept
+    {
+      if (first == nullptr)
+      {
+        return nullptr;
+      };
+
+      char digits[20];
+      int count = 0;
+
+      do
+      {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+      }
+      while (value != 0);
+
+      while (count < width)
+      {
+        digits[count++] = '0';
+      };
+
+      if ((last - first) < count)
+      {
+        return nullptr;
+      };
+
+      while (count != 0)
+      {
+        *first++ = digits[--count];
+      };
+
+      return first;
+    }
+
+    /// @brief      Reads an unsigned integer.
+    /// @param[in]  first: The first character.
+    /// @param[in]  last: The end of the buffer.
+    /// @param[out] value: The value read.
+    /// @param[in]  maxDigits: The maximum number of digits to read.
+    /// @returns    Pointer past the last digit. first if there are no digits.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    char const *readDigits(char const *first, char const *last, std::uint64_t &value, int maxDigits) noexcept
+    {
+      value = 0;
+
+      while ((first != last) && (maxDigits != 0) && (*first >= '0') && (*first <= '9'))
+      {
+        value = value * 10 + static_cast<std::uint64_t>(*first++ - '0');
+        maxDigits--;
+      };
+
+      return first;
+    }
+
+    /// @brief      Reads a fraction (the digits following the decimal point).
+    /// @param[in]  first: The first character after the decimal point.
+    /// @param[in]  last: The end of the buffer.
+    /// @param[out] fraction: The fraction as an integer.
+    /// @param[out] decimals: The number of decimals in fraction. Digits past SEXAGESIMAL_MAXPRECISION are read and discarded.
+    /// @returns    Pointer past the last digit.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    char const *readFraction(char const *first, char const *last, std::uint64_t &fraction, int &decimals) noexcept
+    {
+      char const *end = readDigits(first, last, fraction, SEXAGESIMAL_MAXPRECISION);
+      std::uint64_t discard;
+
+      decimals = static_cast<int>(end - first);
+
+      return readDigits(end, last, discard, -1);
+    }
+  }
+
+  /// @brief      Formats a sexagesimal value.
+  /// @param[in]  first: The start of the buffer.
+  /// @param[in]  last: The end of the buffer.
+  /// @param[in]  value: The value in the leading unit. (Degrees or hours)
+  /// @param[in]  format: The format to use.
+  /// @param[in]  precision: The number of decimals of the seconds. [0; SEXAGESIMAL_MAXPRECISION]
+  /// @returns    {ptr, errc}. ptr is past the last character written. errc is std::errc::value_too_large if the buffer is too
+  ///             small or the value cannot be represented, and std::errc::invalid_argument if the precision is invalid.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::to_chars_result sexagesimalToChars(char *first, char *last, FP_t value, sexagesimalFormat_e format, int precision) noexcept
+  {
+    if ((precision < 0) || (precision > SEXAGESIMAL_MAXPRECISION))
+    {
+      return { last, std::errc::invalid_argument };
+    };
+
+    double magnitude = std::fabs(static_cast<double>(value));
+    std::uint64_t const ticksPerSecond = POWER10[precision];
+    std::uint64_t const ticksPerUnit = 3600 * ticksPerSecond;
+
+    if (!(magnitude * static_cast<double>(ticksPerUnit) < MAXTICKS))
+    {
+      return { last, std::errc::value_too_large };      // Also NaN
+    };
+
+      // One rounding only. The fields are then extracted exactly, so that 59.999 seconds carries into the minutes.
+
+    std::uint64_t ticks = static_cast<std::uint64_t>(std::llround(magnitude * static_cast<double>(ticksPerUnit)));
+    std::uint64_t fraction = ticks % ticksPerSecond;
+    std::uint64_t seconds = (ticks / ticksPerSecond) % 60;
+    std::uint64_t minutes = (ticks / (ticksPerSecond * 60)) % 60;
+    std::uint64_t units = ticks / ticksPerUnit;
+    char *ptr = first;
+
+    if (std::signbit(value) && (ticks != 0))
+    {
+      ptr = writeChar(ptr, last, '-');
+    };
+
+    if (format == SF_SEPARATED)
+    {
+      ptr = writeDigits(ptr, last, units, 2);
+      ptr = writeChar(ptr, last, ':');
+      ptr = writeDigits(ptr, last, minutes, 2);
+      ptr = writeChar(ptr, last, ':');
+      ptr = writeDigits(ptr, last, seconds, 2);
+    }
+    else
+    {
+      ptr = writeDigits(ptr, last, units * 10000 + minutes * 100 + seconds, 6);
+    };
+
+    if (precision != 0)
+    {
+      ptr = writeChar(ptr, last, '.');
+      ptr = writeDigits(ptr, last, fraction, precision);
+    };
+
+    if (ptr == nullptr)
+    {
+      return { last, std::errc::value_too_large };
+    };
+
+    return { ptr, std::errc() };
+  }
+
+  /// @brief      Formats an array of sexagesimal values. The values are separated by a separator character.
+  /// @param[in]  first: The start of the buffer.
+  /// @param[in]  last: The end of the buffer.
+  /// @param[in]  values: The values in the leading unit. (Degrees or hours)
+  /// @param[in]  format: The format to use.
+  /// @param[in]  precision: The number of decimals of the seconds. [0; SEXAGESIMAL_MAXPRECISION]
+  /// @param[in]  separator: The character written after each value.
+  /// @returns    {ptr, errc}. On error, ptr points past the last value that was written completely.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::to_chars_result sexagesimalToChars(char *first, char *last, std::span<FP_t const> values, sexagesimalFormat_e format,
+                                          int precision, char separator) noexcept
+  {
+    for (FP_t value : values)
+    {
+      std::to_chars_result result = sexagesimalToChars(first, last, value, format, precision);
+
+      if (result.ec != std::errc())
+      {
+        return { first, result.ec };
+      }
+      else if (result.ptr == last)
+      {
+        return { first, std::errc::value_too_large };
+      };
+
+      *result.ptr++ = separator;
+      first = result.ptr;
+    };
+
+    return { first, std::errc() };
+  }
+
+  /// @brief      Parses a sexagesimal value.
+  /// @param[in]  first: The first character.
+  /// @param[in]  last: The end of the buffer.
+  /// @param[out] value: The value in the leading unit. (Degrees or hours) Not changed on error.
+  /// @param[in]  format: The format to parse.
+  /// @returns    {ptr, errc}. ptr is past the last character used. errc is std::errc::invalid_argument if the characters do
+  ///             not form a value, and std::errc::result_out_of_range if the minutes or seconds are not less than 60, or
+  ///             the leading unit is too large.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::from_chars_result sexagesimalFromChars(char const *first, char const *last, FP_t &value,
+                                              sexagesimalFormat_e format) noexcept
+  {
+    char const *ptr = first;
+    bool negative = false;
+    std::uint64_t units, minutes, seconds;
+    std::uint64_t fraction = 0;
+    int decimals = 0;
+    char const *end;
+
+    if ((ptr != last) && ((*ptr == '-') || (*ptr == '+')))
+    {
+      negative = (*ptr++ == '-');
+    };
+
+    if (format == SF_SEPARATED)
+    {
+      if ((end = readDigits(ptr, last, units, 10)) == ptr || (end == last) || (*end != ':'))
+      {
+        return { first, std::errc::invalid_argument };
+      };
+      ptr = end + 1;
+      if ((end = readDigits(ptr, last, minutes, 2)) == ptr || (end == last) || (*end != ':'))
+      {
+        return { first, std::errc::invalid_argument };
+      };
+      ptr = end + 1;
+      if ((end = readDigits(ptr, last, seconds, 2)) == ptr)
+      {
+        return { first, std::errc::invalid_argument };
+      };
+      ptr = end;
+    }
+    else
+    {
+      std::uint64_t packed;
+
+      if ((end = readDigits(ptr, last, packed, 14)) == ptr)
+      {
+        return { first, std::errc::invalid_argument };
+      };
+      ptr = end;
+      units = packed / 10000;
+      minutes = (packed / 100) % 100;
+      seconds = packed % 100;
+    };
+
+    if ((ptr != last) && (*ptr == '.'))
+    {
+      ptr = readFraction(ptr + 1, last, fraction, decimals);
+    };
+
+    if ((minutes >= 60) || (seconds >= 60) ||
+        !(static_cast<double>(units + 1) * static_cast<double>(3600 * POWER10[decimals]) < MAXTICKS))
+    {
+      return { ptr, std::errc::result_out_of_range };
+    };
+
+      // The value is a ratio of two integers. A single division gives the correctly rounded value.
+
+    std::uint64_t ticks = ((units * 60 + minutes) * 60 + seconds) * POWER10[decimals] + fraction;
+    double returnValue = static_cast<double>(ticks) / static_cast<double>(3600 * POWER10[decimals]);
+
+    value = static_cast<FP_t>(negative ? -returnValue : returnValue);
+
+    return { ptr, std::errc() };
+  }
+
+  /// @brief      Parses an array of sexagesimal values. Each value must be followed by the separator character. (The separator
+  ///             is optional after the last value.)
+  /// @param[in]  first: The first character.
+  /// @param[in]  last: The end of the buffer.
+  /// @param[out] values: The values in the leading unit. values.size() values are parsed.
+  /// @param[in]  format: The format to parse.
+  /// @param[in]  separator: The character following each value.
+  /// @returns    {ptr, errc}. On error ptr points to the start of the value that could not be parsed.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::from_chars_result sexagesimalFromChars(char const *first, char const *last, std::span<FP_t> values,
+                                              sexagesimalFormat_e format, char separator) noexcept
+  {
+    for (FP_t &value : values)
+    {
+      std::from_chars_result result = sexagesimalFromChars(first, last, value, format);
+
+      if (result.ec != std::errc())
+      {
+        return { first, result.ec };
+      }
+      else if (result.ptr != last)
+      {
+        if (*result.ptr != separator)
+        {
+          return { first, std::errc::invalid_argument };
+        };
+        result.ptr++;
+      };
+
+      first = result.ptr;
+    };
+
+    return { first, std::errc() };
+  }
+
+}   // namespace MCL
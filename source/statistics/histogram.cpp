@@ -0,0 +1,275 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								histogram
+// SUBSYSTEM:						Statistics Functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Histograms with fixed and variable bins.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/statistics/histogram.h"
+
+  // Standard C++ library header files
+
+#include <array>
+#include <bit>
+#include <functional>
+#include <istream>
+#include <numeric>
+#include <ostream>
+#include <system_error>
+
+namespace MCL
+{
+  namespace
+  {
+    char constexpr MAGIC[8] = { 'M', 'C', 'L', 'H', 'I', 'S', 'T', 'O' };
+    std::size_t constexpr HEADER = 48;
+    std::uint16_t constexpr FLAG_FIXED = 1;
+
+    /// @brief Stores an unsigned value as little-endian bytes.
+
+    template<typename T>
+    void storeLE(char *p, T value) noexcept
+    {
+      for (std::size_t index = 0; index < sizeof(T); index++)
+      {
+        p[index] = static_cast<char>((value >> (8 * index)) & 0xFF);
+      };
+    }
+
+    /// @brief Loads an unsigned value from little-endian bytes.
+
+    template<typename T>
+    T loadLE(char const *p) noexcept
+    {
+      T value = 0;
+
+      for (std::size_t index = 0; index < sizeof(T); index++)
+      {
+        value |= static_cast<T>(static_cast<unsigned char>(p[index])) << (8 * index);
+      };
+
+      return value;
+    }
+
+    /// @brief Reads a little-endian uint64 from a stream.
+
+    bool readLE(std::istream &is, std::uint64_t &value)
+    {
+      std::array<char, 8> buffer;
+
+      if (is.read(buffer.data(), buffer.size()))
+      {
+        value = loadLE<std::uint64_t>(buffer.data());
+        return true;
+      }
+      else
+      {
+        return false;
+      };
+    }
+  }
+
+  /// @brief      Constructs a histogram with bins of equal width.
+  /// @param[in]  lower: The lower edge of the first bin.
+  /// @param[in]  upper: The upper edge of the last bin.
+  /// @param[in]  bins: The number of bins.
+  /// @throws     std::invalid_argument - bins is zero, or the edges are not finite and increasing.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  histogram_t::histogram_t(FP_t lower, FP_t upper, std::size_t bins) : counts_(bins), fixed_(true)
+  {
+    if ( (bins == 0) || !std::isfinite(lower) || !std::isfinite(upper) || !(lower < upper) )
+    {
+      throw std::invalid_argument("MCL::histogram_t - Invalid fixed width bins.");
+    };
+
+    edges_.resize(bins + 1);
+    for (std::size_t index = 0; index < bins; index++)
+    {
+      edges_[index] = lower + (upper - lower) * static_cast<FP_t>(index) / static_cast<FP_t>(bins);
+    };
+    edges_[bins] = upper;
+    scale_ = static_cast<FP_t>(bins) / (upper - lower);
+  }
+
+  /// @brief      Constructs a histogram with the specified bin edges.
+  /// @param[in]  edges: The edges of the bins. (At least two, finite and strictly increasing.)
+  /// @throws     std::invalid_argument - The edges are not valid.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  histogram_t::histogram_t(std::vector<FP_t> edges) : edges_(std::move(edges))
+  {
+    if ( (edges_.size() < 2) || !std::all_of(edges_.begin(), edges_.end(), [](FP_t edge) { return std::isfinite(edge); }) ||
+         (std::adjacent_find(edges_.begin(), edges_.end(), std::greater_equal<FP_t>()) != edges_.end()) )
+    {
+      throw std::invalid_argument("MCL::histogram_t - The edges must be finite and strictly increasing.");
+    };
+
+    counts_.resize(edges_.size() - 1);
+  }
+
+  /// @brief      Adds the counts of another histogram.
+  /// @param[in]  other: The histogram to add. The edges must be the same.
+  /// @throws     std::invalid_argument - The edges differ.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void histogram_t::merge(histogram_t const &other)
+  {
+    if (edges_ != other.edges_)
+    {
+      throw std::invalid_argument("MCL::histogram_t::merge - The edges of the histograms differ.");
+    };
+
+    std::transform(counts_.begin(), counts_.end(), other.counts_.begin(), counts_.begin(), std::plus<std::uint64_t>());
+    underflow_ += other.underflow_;
+    overflow_ += other.overflow_;
+    nan_ += other.nan_;
+  }
+
+  /// @brief      Sets all the counts to zero. The bins are not changed.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void histogram_t::clear() noexcept
+  {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    underflow_ = overflow_ = nan_ = 0;
+  }
+
+  /// @brief      Returns the number of values added, including underflow, overflow and NaN.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::uint64_t histogram_t::total() const noexcept
+  {
+    return std::accumulate(counts_.begin(), counts_.end(), underflow_ + overflow_ + nan_);
+  }
+
+  /// @brief      Writes the histogram to a stream. (See the file overview for the layout.)
+  /// @param[in]  os: The stream. (Opened in binary mode.)
+  /// @throws     std::system_error - The stream cannot be written.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  void histogram_t::serialise(std::ostream &os) const
+  {
+    std::vector<char> buffer(HEADER + 8 * (edges_.size() + counts_.size()));
+    char *p = buffer.data();
+
+    std::copy(std::begin(MAGIC), std::end(MAGIC), p);
+    storeLE(p + 8, HISTOGRAM_VERSION);
+    storeLE(p + 10, fixed_ ? FLAG_FIXED : std::uint16_t{0});
+    storeLE(p + 12, std::uint32_t{0});
+    storeLE(p + 16, static_cast<std::uint64_t>(counts_.size()));
+    storeLE(p + 24, underflow_);
+    storeLE(p + 32, overflow_);
+    storeLE(p + 40, nan_);
+    p += HEADER;
+
+    for (FP_t edge : edges_)
+    {
+      storeLE(p, std::bit_cast<std::uint64_t>(static_cast<double>(edge)));
+      p += 8;
+    };
+
+    for (std::uint64_t count : counts_)
+    {
+      storeLE(p, count);
+      p += 8;
+    };
+
+    if (!os.write(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+    {
+      throw std::system_error(std::make_error_code(std::errc::io_error), "MCL::histogram_t::serialise - Unable to write.");
+    };
+  }
+
+  /// @brief      Reads a histogram written by serialise().
+  /// @param[in]  is: The stream. (Opened in binary mode.)
+  /// @returns    The histogram.
+  /// @throws     std::runtime_error - The stream does not contain a histogram, is a later version or is truncated.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  histogram_t histogram_t::deserialise(std::istream &is)
+  {
+    std::array<char, HEADER> header;
+
+    if ( !is.read(header.data(), header.size()) || !std::equal(std::begin(MAGIC), std::end(MAGIC), header.begin()) )
+    {
+      throw std::runtime_error("MCL::histogram_t::deserialise - Not a histogram.");
+    };
+
+    if (loadLE<std::uint16_t>(header.data() + 8) > HISTOGRAM_VERSION)
+    {
+      throw std::runtime_error("MCL::histogram_t::deserialise - Unsupported version.");
+    };
+
+    bool fixed = (loadLE<std::uint16_t>(header.data() + 10) & FLAG_FIXED) != 0;
+    std::uint64_t bins = loadLE<std::uint64_t>(header.data() + 16);
+    std::vector<FP_t> edges;
+    std::vector<std::uint64_t> counts;
+    std::uint64_t value;
+
+    for (std::uint64_t index = 0; (bins != 0) && (index <= bins) && readLE(is, value); index++)
+    {
+      edges.push_back(static_cast<FP_t>(std::bit_cast<double>(value)));
+    };
+
+    for (std::uint64_t index = 0; (index < bins) && readLE(is, value); index++)
+    {
+      counts.push_back(value);
+    };
+
+    if ( (bins == 0) || (edges.size() != bins + 1) || (counts.size() != bins) )
+    {
+      throw std::runtime_error("MCL::histogram_t::deserialise - Invalid or truncated histogram.");
+    };
+
+    histogram_t histogram;
+
+    try
+    {
+      histogram = fixed ? histogram_t(edges.front(), edges.back(), bins) : histogram_t(std::move(edges));
+    }
+    catch (std::invalid_argument const &)
+    {
+      throw std::runtime_error("MCL::histogram_t::deserialise - Invalid or truncated histogram.");
+    };
+
+    histogram.counts_ = std::move(counts);
+    histogram.underflow_ = loadLE<std::uint64_t>(header.data() + 24);
+    histogram.overflow_ = loadLE<std::uint64_t>(header.data() + 32);
+    histogram.nan_ = loadLE<std::uint64_t>(header.data() + 40);
+
+    return histogram;
+  }
+
+}  // namespace MCL
@@ -0,0 +1,92 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								cancellation
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Cooperative cancellation of the long-running functions.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/utility/cancellation.h"
+
+  // MCL library header files
+
+#include "include/exceptions.h"
+
+namespace MCL
+{
+  namespace
+  {
+    thread_local cancellation_t const *currentCancellation = nullptr;
+  }
+
+  /// @brief      Throws if a stop has been requested or the deadline has passed. A stop request takes precedence.
+  /// @throws     MCL::operation_cancelled
+  /// @throws     MCL::deadline_exceeded
+  /// @version    2026-10-19/GGB - Function created.
+
+  void cancellation_t::check() const
+  {
+    if (stopRequested())
+    {
+      throw operation_cancelled("MCL - Operation cancelled.");
+    }
+    else if (expired())
+    {
+      throw deadline_exceeded("MCL - Operation deadline exceeded.");
+    };
+  }
+
+  /// @brief      Returns the cancellation of the calling thread.
+  /// @returns    Pointer to the cancellation. nullptr if none is installed.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  cancellation_t const *cancellation_t::current() noexcept
+  {
+    return currentCancellation;
+  }
+
+  /// @brief      Installs a cancellation for the calling thread.
+  /// @param[in]  cancellation: The cancellation to install. (nullptr to remove the cancellation.)
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  cancellation_t::scope_t::scope_t(cancellation_t const *cancellation) noexcept : previous(currentCancellation)
+  {
+    currentCancellation = cancellation;
+  }
+
+  /// @brief      Restores the previous cancellation.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  cancellation_t::scope_t::~scope_t()
+  {
+    currentCancellation = previous;
+  }
+
+}   // namespace MCL
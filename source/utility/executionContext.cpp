@@ -0,0 +1,282 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								executionContext
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Threading budget and CPU detection.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/utility/executionContext.h"
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace MCL
+{
+  namespace
+  {
+    thread_local executionContext_t const *currentContext = nullptr;
+
+    /// @brief Returns the first line of a file. (Empty if the file cannot be read.)
+
+    std::string readLine(std::string const &path)
+    {
+      std::ifstream ifs(path);
+      std::string line;
+
+      std::getline(ifs, line);
+
+      return line;
+    }
+
+#ifdef __linux__
+    /// @brief Returns the CPU limit of the cgroup of the process, if there is one.
+
+    std::optional<std::size_t> cgroupLimit()
+    {
+        // cgroup v2. /proc/self/cgroup contains "0::<path>".
+
+      std::ifstream ifs("/proc/self/cgroup");
+      std::string line;
+
+      while (std::getline(ifs, line))
+      {
+        if (line.starts_with("0::"))
+        {
+          std::string path = line.substr(3);
+
+          for (std::string directory : { "/sys/fs/cgroup" + path, std::string("/sys/fs/cgroup") })
+          {
+            std::string value = readLine(directory + "/cpu.max");
+
+            if (!value.empty())
+            {
+              return detail::cgroupV2Limit(value);
+            };
+          };
+        };
+      };
+
+        // cgroup v1.
+
+      for (char const *directory : { "/sys/fs/cgroup/cpu", "/sys/fs/cgroup/cpu,cpuacct" })
+      {
+        std::string quota = readLine(std::string(directory) + "/cpu.cfs_quota_us");
+        std::string period = readLine(std::string(directory) + "/cpu.cfs_period_us");
+
+        if (!quota.empty() && !period.empty())
+        {
+          try
+          {
+            return detail::cgroupV1Limit(std::stoll(quota), std::stoll(period));
+          }
+          catch (...)
+          {
+            return std::nullopt;
+          };
+        };
+      };
+
+      return std::nullopt;
+    }
+#endif
+  }
+
+  namespace detail
+  {
+    /// @brief      Parses the content of a cgroup v2 cpu.max file. ("<quota> <period>" or "max <period>")
+    /// @param[in]  text: The content of the file.
+    /// @returns    The number of CPUs (quota / period rounded up). No value if there is no limit or the text is invalid.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::optional<std::size_t> cgroupV2Limit(std::string_view text) noexcept
+    {
+      long long quota = 0;
+      long long period = 0;
+      char const *first = text.data();
+      char const *last = text.data() + text.size();
+
+      if (text.starts_with("max"))
+      {
+        return std::nullopt;
+      };
+
+      std::from_chars_result result = std::from_chars(first, last, quota);
+
+      if ( (result.ec != std::errc()) || (result.ptr == last) || (*result.ptr != ' ') )
+      {
+        return std::nullopt;
+      };
+
+      result = std::from_chars(result.ptr + 1, last, period);
+
+      if (result.ec != std::errc())
+      {
+        return std::nullopt;
+      };
+
+      return cgroupV1Limit(quota, period);
+    }
+
+    /// @brief      Converts a cgroup CPU quota and period to a number of CPUs.
+    /// @param[in]  quota: The quota. (Negative if there is no limit.)
+    /// @param[in]  period: The period.
+    /// @returns    The number of CPUs (quota / period rounded up). No value if there is no limit.
+    /// @throws     None.
+    /// @version    2026-10-19/GGB - Function created.
+
+    std::optional<std::size_t> cgroupV1Limit(long long quota, long long period) noexcept
+    {
+      if ( (quota <= 0) || (period <= 0) )
+      {
+        return std::nullopt;
+      }
+      else
+      {
+        return static_cast<std::size_t>((quota + period - 1) / period);
+      };
+    }
+  }
+
+  /// @brief      Returns the number of CPUs that the process may use. This is the smaller of the hardware concurrency, the
+  ///             number of CPUs in the affinity mask of the process and the cgroup CPU quota (rounded up).
+  /// @returns    The number of CPUs. [1; hardware_concurrency]
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::size_t availableConcurrency() noexcept
+  {
+    std::size_t count = std::max(1U, std::thread::hardware_concurrency());
+
+#ifdef __linux__
+    cpu_set_t mask;
+
+    if (::sched_getaffinity(0, sizeof(mask), &mask) == 0)
+    {
+      count = std::min(count, static_cast<std::size_t>(CPU_COUNT(&mask)));
+    };
+
+    try
+    {
+      if (std::optional<std::size_t> limit = cgroupLimit())
+      {
+        count = std::min(count, *limit);
+      };
+    }
+    catch (...)
+    {
+    };
+#endif
+
+    return std::max(std::size_t{1}, count);
+  }
+
+  /// @brief      Constructs a context with the number of threads set to the number of CPUs available to the process.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  executionContext_t::executionContext_t() : maxThreads_(availableConcurrency())
+  {
+  }
+
+  /// @brief      Constructs a context.
+  /// @param[in]  threads: The maximum number of threads. (Zero is treated as one.)
+  /// @param[in]  cpus: The CPUs to pin the worker threads to. Worker thread n is pinned to cpus[n % cpus.size()].
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  executionContext_t::executionContext_t(std::size_t threads, std::vector<int> cpus)
+    : maxThreads_((threads == 0) ? 1 : threads), cpus_(std::move(cpus))
+  {
+  }
+
+  /// @brief      Called by a worker thread when it starts. Pins the thread if the context has a CPU list.
+  /// @param[in]  threadNumber: The number of the worker thread.
+  /// @throws     None.
+  /// @note       Pinning is only supported on Linux. On other systems the CPU list is ignored.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void executionContext_t::enter(std::size_t threadNumber) const noexcept
+  {
+#ifdef __linux__
+    if (!cpus_.empty())
+    {
+      int cpu = cpus_[threadNumber % cpus_.size()];
+
+      if ( (cpu >= 0) && (cpu < CPU_SETSIZE) )
+      {
+        cpu_set_t mask;
+
+        CPU_ZERO(&mask);
+        CPU_SET(cpu, &mask);
+        ::pthread_setaffinity_np(::pthread_self(), sizeof(mask), &mask);
+      };
+    };
+#endif
+  }
+
+  /// @brief      Returns the context of the calling thread.
+  /// @returns    Pointer to the context. nullptr if no context is installed.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  executionContext_t const *executionContext_t::current() noexcept
+  {
+    return currentContext;
+  }
+
+  /// @brief      Installs a context for the calling thread.
+  /// @param[in]  context: The context to install. (nullptr to use MCL::maxThreads.)
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  executionContext_t::scope_t::scope_t(executionContext_t const *context) noexcept : previous(currentContext)
+  {
+    currentContext = context;
+  }
+
+  /// @brief      Restores the previous context.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  executionContext_t::scope_t::~scope_t()
+  {
+    currentContext = previous;
+  }
+
+}   // namespace MCL
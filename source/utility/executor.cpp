@@ -0,0 +1,157 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								executor
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A fixed pool of worker threads for the asynchronous functions.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/utility/executor.h"
+
+  // MCL library header files
+
+#include "include/utility/executionContext.h"
+
+namespace MCL
+{
+  /// @brief      Constructs a pool with one thread per CPU available to the process.
+  /// @throws     std::system_error
+  /// @version    2026-10-19/GGB - Function created.
+
+  executor_t::executor_t() : executor_t(availableConcurrency())
+  {
+  }
+
+  /// @brief      Constructs a pool.
+  /// @param[in]  threads: The number of worker threads. (Zero is treated as one.)
+  /// @throws     std::system_error
+  /// @throws     std::bad_alloc
+  /// @note       If a thread cannot be started, the threads that have been started are joined before the exception
+  ///             propagates.
+  /// @version    2026-10-19/GGB - Function created.
+
+  executor_t::executor_t(std::size_t threads)
+  {
+    threads = (threads == 0) ? 1 : threads;
+
+    try
+    {
+      workers.reserve(threads);
+
+      for (std::size_t index = 0; index < threads; index++)
+      {
+        workers.emplace_back(&executor_t::run, this);
+      };
+    }
+    catch (...)
+    {
+      stop();
+      throw;
+    };
+  }
+
+  /// @brief      Runs the queued tasks and joins the worker threads.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  executor_t::~executor_t()
+  {
+    stop();
+  }
+
+  /// @brief      Stops the worker threads once the queue is empty, and joins them.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void executor_t::stop() noexcept
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    condition.notify_all();
+
+    for (auto &thread: workers)
+    {
+      thread.join();
+    };
+  }
+
+  /// @brief      Queues a task. The task must not throw. (Exceptions are reported through the future by the async
+  ///             functions.)
+  /// @param[in]  task: The task to run.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  void executor_t::post(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push_back(std::move(task));
+    }
+    condition.notify_one();
+  }
+
+  /// @brief      The function of the worker threads. Runs tasks until the pool is destroyed and the queue is empty.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void executor_t::run()
+  {
+    for (;;)
+    {
+      std::function<void()> task;
+
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        condition.wait(lock, [this]() { return stopping || !queue.empty(); });
+
+        if (queue.empty())
+        {
+          return;
+        };
+
+        task = std::move(queue.front());
+        queue.pop_front();
+      }
+
+      task();
+    };
+  }
+
+  /// @brief      Returns the pool used by the asynchronous functions when no executor is specified.
+  /// @throws     std::system_error
+  /// @version    2026-10-19/GGB - Function created.
+
+  executor_t &executor_t::global()
+  {
+    static executor_t executor;
+    return executor;
+  }
+
+}   // namespace MCL
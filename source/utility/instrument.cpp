@@ -0,0 +1,437 @@
+﻿//**********************************************************************************************************************************
+//
+// PROJECT:							MCL (Math Class Library)
+// FILE:								instrument
+// SUBSYSTEM:						Utility functions
+// LANGUAGE:						C++
+// TARGET OS:						WINDOWS/UNIX/LINUX/MAC
+// LIBRARY DEPENDANCE:	None
+// NAMESPACE:						MCL::instrument
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the Maths Class Library (MCL)
+//
+//                      MCL is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+//                      License as published by the Free Software Foundation, either version 2 of the License, or (at your option)
+//                      any later version.
+//
+//                      MCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//                      warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//                      more details.
+//
+//                      You should have received a copy of the GNU General Public License along with MCL.  If not, see
+//                      <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Per-thread counters, trace events and export of the instrumentation.
+//
+// HISTORY:             2026-10-19 GGB - File Created.
+//
+//**********************************************************************************************************************************
+
+#include "include/utility/instrument.h"
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+namespace MCL::instrument
+{
+  namespace
+  {
+    std::chrono::steady_clock::time_point const epoch = std::chrono::steady_clock::now();
+
+    /// @brief Returns the time since the epoch. (ns)
+
+    std::uint64_t now() noexcept
+    {
+      return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+    }
+
+    /// @brief Counters of a kernel, written by one thread.
+
+    struct counters_t
+    {
+      std::atomic<std::uint64_t> calls{0};
+      std::atomic<std::uint64_t> elements{0};
+      std::atomic<std::uint64_t> bytes{0};
+      std::atomic<std::uint64_t> threads{0};
+      std::atomic<std::uint64_t> nanoseconds{0};
+    };
+
+    struct threadData_t;
+
+    /// @brief The kernel names, the live threads and the totals of the threads that have exited.
+
+    struct registry_t
+    {
+      std::mutex mutex;
+      std::vector<char const *> names;
+      std::vector<threadData_t *> threads;
+      std::array<kernelStats_t, MAX_KERNELS> retired;
+      std::vector<event_t> retiredEvents;
+      std::uint32_t threadSequence = 0;
+    };
+
+    /// @brief Returns the registry. The registry is never destroyed, as threads of static objects (the executor) may
+    ///        exit after the static objects of this file are destroyed.
+
+    registry_t &registry()
+    {
+      static registry_t *r = new registry_t;
+      return *r;
+    }
+
+    /// @brief The counters and trace events of a thread. The counters are folded into the registry when the thread exits.
+
+    struct threadData_t
+    {
+      std::array<counters_t, MAX_KERNELS> counters;
+      std::mutex eventMutex;                          ///< Only contended while the events are exported.
+      std::vector<event_t> events;
+      std::uint32_t sequence;
+
+      threadData_t()
+      {
+        std::lock_guard<std::mutex> lock(registry().mutex);
+
+        sequence = registry().threadSequence++;
+        registry().threads.push_back(this);
+      }
+
+      ~threadData_t()
+      {
+        registry_t &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+
+        for (std::size_t id = 0; id < MAX_KERNELS; id++)
+        {
+          r.retired[id].calls += counters[id].calls.load(std::memory_order_relaxed);
+          r.retired[id].elements += counters[id].elements.load(std::memory_order_relaxed);
+          r.retired[id].bytes += counters[id].bytes.load(std::memory_order_relaxed);
+          r.retired[id].threads += counters[id].threads.load(std::memory_order_relaxed);
+          r.retired[id].nanoseconds += counters[id].nanoseconds.load(std::memory_order_relaxed);
+        };
+
+        std::lock_guard<std::mutex> eventLock(eventMutex);
+        r.retiredEvents.insert(r.retiredEvents.end(), events.begin(), events.end());
+        r.threads.erase(std::find(r.threads.begin(), r.threads.end(), this));
+      }
+    };
+
+    threadData_t &local()
+    {
+      thread_local threadData_t data;
+      return data;
+    }
+
+    struct callbackEntry_t
+    {
+      callback_t fn;
+      void *context;
+    };
+
+    std::array<std::atomic<char const *>, MAX_KERNELS> kernelNames{};   ///< Read without the lock when recording events.
+    std::atomic<bool> tracing{false};
+    std::atomic<callbackEntry_t const *> callback{nullptr};
+    thread_local scope_t *currentScope = nullptr;
+
+    /// @brief Appends a string to a JSON document, with quotes and escapes.
+
+    void appendString(std::string &json, char const *text)
+    {
+      json += '"';
+      for (char const *p = text; *p != 0; p++)
+      {
+        if ( (*p == '"') || (*p == '\\') )
+        {
+          json += '\\';
+        };
+        json += *p;
+      };
+      json += '"';
+    }
+
+    /// @brief Appends a time in microseconds (with three decimals) to a JSON document.
+
+    void appendMicroseconds(std::string &json, std::uint64_t nanoseconds)
+    {
+      std::string fraction = std::to_string(nanoseconds % 1000);
+
+      json += std::to_string(nanoseconds / 1000) + "." + std::string(3 - fraction.size(), '0') + fraction;
+    }
+  }
+
+  /// @brief      Registers a kernel (or phase) name. A name that is already registered returns the same id.
+  /// @param[in]  name: The name. Must remain valid for the life of the program. (A string literal.)
+  /// @returns    The id of the kernel. MAX_KERNELS if there is no space for the name. (The kernel is then not recorded.)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::size_t registerKernel(char const *name)
+  {
+    registry_t &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    for (std::size_t id = 0; id < r.names.size(); id++)
+    {
+      if (std::strcmp(r.names[id], name) == 0)
+      {
+        return id;
+      };
+    };
+
+    if (r.names.size() == MAX_KERNELS)
+    {
+      return MAX_KERNELS;
+    };
+
+    r.names.push_back(name);
+    kernelNames[r.names.size() - 1].store(name, std::memory_order_release);
+    return r.names.size() - 1;
+  }
+
+  /// @brief      Returns the totals of all the registered kernels, over all the threads.
+  /// @returns    The totals, in the order the kernels were registered.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::vector<kernelStats_t> snapshot()
+  {
+    registry_t &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    std::vector<kernelStats_t> result(r.names.size());
+
+    for (std::size_t id = 0; id < r.names.size(); id++)
+    {
+      result[id] = r.retired[id];
+      result[id].name = r.names[id];
+
+      for (threadData_t const *thread : r.threads)
+      {
+        result[id].calls += thread->counters[id].calls.load(std::memory_order_relaxed);
+        result[id].elements += thread->counters[id].elements.load(std::memory_order_relaxed);
+        result[id].bytes += thread->counters[id].bytes.load(std::memory_order_relaxed);
+        result[id].threads += thread->counters[id].threads.load(std::memory_order_relaxed);
+        result[id].nanoseconds += thread->counters[id].nanoseconds.load(std::memory_order_relaxed);
+      };
+    };
+
+    return result;
+  }
+
+  /// @brief      Returns the recorded trace events of all the threads.
+  /// @returns    The events, ordered by start time.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::vector<event_t> events()
+  {
+    registry_t &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    std::vector<event_t> result(r.retiredEvents);
+
+    for (threadData_t *thread : r.threads)
+    {
+      std::lock_guard<std::mutex> eventLock(thread->eventMutex);
+      result.insert(result.end(), thread->events.begin(), thread->events.end());
+    };
+
+    std::sort(result.begin(), result.end(), [](event_t const &a, event_t const &b) { return a.start < b.start; });
+
+    return result;
+  }
+
+  /// @brief      Clears the counters and the trace events. The kernel names remain registered.
+  /// @throws     None.
+  /// @note       Counts recorded by other threads while the reset is in progress may be lost.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void reset()
+  {
+    registry_t &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    r.retired.fill(kernelStats_t{});
+    r.retiredEvents.clear();
+
+    for (threadData_t *thread : r.threads)
+    {
+      for (counters_t &c : thread->counters)
+      {
+        c.calls.store(0, std::memory_order_relaxed);
+        c.elements.store(0, std::memory_order_relaxed);
+        c.bytes.store(0, std::memory_order_relaxed);
+        c.threads.store(0, std::memory_order_relaxed);
+        c.nanoseconds.store(0, std::memory_order_relaxed);
+      };
+
+      std::lock_guard<std::mutex> eventLock(thread->eventMutex);
+      thread->events.clear();
+    };
+  }
+
+  /// @brief      Enables or disables the recording of trace events.
+  /// @param[in]  enable: true to record events.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void enableTrace(bool enable) noexcept
+  {
+    tracing.store(enable, std::memory_order_relaxed);
+  }
+
+  /// @brief      Returns true if trace events are recorded.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  bool traceEnabled() noexcept
+  {
+    return tracing.load(std::memory_order_relaxed);
+  }
+
+  /// @brief      Sets the function that is called with each completed event. The function is called on the thread that
+  ///             recorded the event, and must not throw.
+  /// @param[in]  fn: The function. nullptr to remove the callback.
+  /// @param[in]  context: Passed to the function.
+  /// @throws     std::bad_alloc
+  /// @note       The previous callback entry is not freed, as another thread may still be calling it.
+  /// @version    2026-10-19/GGB - Function created.
+
+  void setCallback(callback_t fn, void *context)
+  {
+    callback.store(fn ? new callbackEntry_t{ fn, context } : nullptr, std::memory_order_release);
+  }
+
+  /// @brief      Exports the kernel totals as a JSON document.
+  /// @returns    {"kernels":[{"name":..., "calls":..., "elements":..., "bytes":..., "threads":..., "nanoseconds":...}, ...]}
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::string toJSON()
+  {
+    std::string json = "{\"kernels\":[";
+    bool first = true;
+
+    for (kernelStats_t const &k : snapshot())
+    {
+      json += first ? "{\"name\":" : ",{\"name\":";
+      appendString(json, k.name.c_str());
+      json += ",\"calls\":" + std::to_string(k.calls) + ",\"elements\":" + std::to_string(k.elements) +
+              ",\"bytes\":" + std::to_string(k.bytes) + ",\"threads\":" + std::to_string(k.threads) +
+              ",\"nanoseconds\":" + std::to_string(k.nanoseconds) + "}";
+      first = false;
+    };
+
+    json += "]}";
+
+    return json;
+  }
+
+  /// @brief      Exports the trace events in the Chrome trace event format. (Complete events, times in microseconds.)
+  /// @returns    The JSON document.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-19/GGB - Function created.
+
+  std::string toChromeTrace()
+  {
+    std::string json = "{\"traceEvents\":[";
+    bool first = true;
+
+    for (event_t const &e : events())
+    {
+      json += first ? "{\"name\":" : ",{\"name\":";
+      appendString(json, e.name);
+      json += ",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(e.thread) + ",\"ts\":";
+      appendMicroseconds(json, e.start);
+      json += ",\"dur\":";
+      appendMicroseconds(json, e.duration);
+      json += ",\"args\":{\"elements\":" + std::to_string(e.elements) + ",\"bytes\":" + std::to_string(e.bytes) +
+              ",\"threads\":" + std::to_string(e.threads) + "}}";
+      first = false;
+    };
+
+    json += "],\"displayTimeUnit\":\"ns\"}";
+
+    return json;
+  }
+
+  /// @brief      Starts timing a kernel.
+  /// @param[in]  kernel: The id returned by registerKernel().
+  /// @param[in]  elementCount: The number of elements processed.
+  /// @param[in]  byteCount: The number of bytes read.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  scope_t::scope_t(std::size_t kernel, std::uint64_t elementCount, std::uint64_t byteCount) noexcept
+    : id(kernel), elements(elementCount), bytes(byteCount), start(now()), parent(currentScope)
+  {
+    currentScope = this;
+  }
+
+  /// @brief      Records the scope.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  scope_t::~scope_t()
+  {
+    std::uint64_t duration = now() - start;
+
+    currentScope = parent;
+
+    if (id < MAX_KERNELS)
+    {
+      threadData_t &data = local();
+      counters_t &c = data.counters[id];
+
+      c.calls.fetch_add(1, std::memory_order_relaxed);
+      c.elements.fetch_add(elements, std::memory_order_relaxed);
+      c.bytes.fetch_add(bytes, std::memory_order_relaxed);
+      c.threads.fetch_add(threads, std::memory_order_relaxed);
+      c.nanoseconds.fetch_add(duration, std::memory_order_relaxed);
+
+      bool trace = tracing.load(std::memory_order_relaxed);
+      callbackEntry_t const *cb = callback.load(std::memory_order_acquire);
+
+      if (trace || cb)
+      {
+        event_t event{ kernelNames[id].load(std::memory_order_acquire), start, duration, elements, bytes, threads, data.sequence };
+
+        if (trace)
+        {
+          try
+          {
+            std::lock_guard<std::mutex> lock(data.eventMutex);
+            data.events.push_back(event);
+          }
+          catch (...)
+          {
+          };
+        };
+
+        if (cb)
+        {
+          cb->fn(event, cb->context);
+        };
+      };
+    };
+  }
+
+  /// @brief      Returns the innermost scope of the calling thread.
+  /// @returns    Pointer to the scope. nullptr if there is none.
+  /// @throws     None.
+  /// @version    2026-10-19/GGB - Function created.
+
+  scope_t *scope_t::current() noexcept
+  {
+    return currentScope;
+  }
+
+}   // namespace MCL::instrument
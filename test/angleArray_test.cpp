@@ -0,0 +1,140 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "include/angleArray.h"
+#include "include/trigonometryArray.hpp"
+
+BOOST_AUTO_TEST_SUITE(angleArray)
+
+BOOST_AUTO_TEST_CASE(trigonometry)
+{
+  std::vector<double> x(20000);
+  std::vector<double> s(x.size()), c(x.size()), t(x.size());
+
+  for (std::size_t index = 0; index < x.size(); index++)
+  {
+    x[index] = (static_cast<double>(index) - 10000.0) * 0.01;
+  };
+  x[0] = 1e20;
+  x[1] = std::numeric_limits<double>::quiet_NaN();
+
+  MCL::sincos<double>(x, s, c);
+  MCL::tan<double>(x, t);
+
+  for (std::size_t index = 2; index < x.size(); index++)
+  {
+    BOOST_TEST(s[index] == std::sin(x[index]), boost::test_tools::tolerance(1e-15));
+    BOOST_TEST(c[index] == std::cos(x[index]), boost::test_tools::tolerance(1e-15));
+  };
+  BOOST_TEST(s[0] == std::sin(1e20));
+  BOOST_TEST(std::isnan(c[1]));
+  BOOST_TEST(t[10100] == std::tan(1.0), boost::test_tools::tolerance(1e-15));
+
+  std::vector<float> xf = { 0.5f, -2.0f, 3.0f };
+  std::vector<float> sf(3);
+  MCL::sin<float>(xf, sf);
+  BOOST_TEST(sf[1] == std::sin(-2.0f), boost::test_tools::tolerance(1e-6f));
+
+  std::vector<double> small(1);
+  BOOST_CHECK_THROW(MCL::sin<double>(x, small), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(reciprocal)
+{
+  std::vector<double> x = { 0.0, MCL::PI_DIV_2, 1.0, -1.0, 1e20, std::numeric_limits<double>::quiet_NaN() };
+  std::vector<double> r(x.size());
+  std::vector<std::uint8_t> mask(x.size());
+
+  BOOST_TEST(MCL::cosec<double>(x, r, mask) == 2);
+  BOOST_TEST(std::isnan(r[0]));
+  BOOST_TEST(r[2] == 1 / std::sin(1.0), boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(r[3] == -1 / std::sin(1.0), boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(r[4] == 1 / std::sin(1e20), boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(mask == std::vector<std::uint8_t>({ 1, 0, 0, 0, 0, 1 }), boost::test_tools::per_element());
+
+  BOOST_TEST(MCL::sec<double>(x, r, {}, MCL::TS_INFINITY, 1e-12) == 2);
+  BOOST_TEST(std::isinf(r[1]));
+  BOOST_TEST(r[0] == 1.0);
+
+  BOOST_TEST(MCL::cot<double>(x, r, mask, MCL::TS_INFINITY) == 2);
+  BOOST_TEST(r[0] == std::numeric_limits<double>::infinity());
+  BOOST_TEST(std::fabs(r[1]) < 1e-15);
+  BOOST_TEST(std::isnan(r[5]));
+
+  std::vector<float> xf = { 0.0f, 0.5f };
+  std::vector<float> rf(2);
+  BOOST_TEST(MCL::cot<float>(xf, rf) == 1);
+  BOOST_TEST(rf[1] == 1 / std::tan(0.5f), boost::test_tools::tolerance(1e-6f));
+}
+
+BOOST_AUTO_TEST_CASE(conversion)
+{
+  std::vector<double> dms = { 123015.5, -103000.0 };
+  std::vector<double> hms = { 123000.0 };
+  MCL::angleArray_t angles(dms, MCL::AF_DMSs);
+  std::vector<double> out(2);
+
+  angles.degrees(out);
+  BOOST_TEST(out[0] == 12.0 + 30.0 / 60 + 15.5 / 3600, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(out[1] == -10.5, boost::test_tools::tolerance(1e-12));
+
+  angles.convert(out, MCL::AF_DMSs);
+  BOOST_TEST(out[0] == 123015.5, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(out[1] == -103000.0, boost::test_tools::tolerance(1e-12));
+
+  MCL::angleArray_t ra(hms, MCL::AF_HMSs);
+  ra.hours(out);
+  BOOST_TEST(out[0] == 12.5, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(ra[0] == MCL::PI * 12.5 / 12, boost::test_tools::tolerance(1e-12));
+
+  BOOST_CHECK_THROW(MCL::angleArray_t(dms, MCL::AF_NONE), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(modulo)
+{
+  std::vector<double> values = { -0.5, 7.0, 3.5 };
+  MCL::angleArray_t angles(values);
+
+  angles.moduloN();
+  BOOST_TEST(angles[0] == MCL::PI_2 - 0.5, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(angles[1] == 7.0 - MCL::PI_2, boost::test_tools::tolerance(1e-12));
+
+  angles.moduloR();
+  BOOST_TEST(angles[0] == -0.5, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(angles[2] == 3.5 - MCL::PI_2, boost::test_tools::tolerance(1e-12));
+
+  std::vector<double> tiny = { -1e-17, std::nextafter(-MCL::PI, -4.0) };
+  MCL::angleArray_t edge(tiny);
+
+  edge.moduloN();
+  BOOST_TEST(edge[0] >= 0.0);
+  BOOST_TEST(edge[0] < MCL::PI_2);
+
+  edge = MCL::angleArray_t(tiny);
+  edge.moduloR();
+  BOOST_TEST(edge[1] >= -MCL::PI);
+  BOOST_TEST(edge[1] < MCL::PI);
+}
+
+BOOST_AUTO_TEST_CASE(interop)
+{
+  std::vector<MCL::CAngle> single = { MCL::CAngle(30, MCL::AF_Dd), MCL::CAngle(1.0) };
+  MCL::angleArray_t angles{std::span<MCL::CAngle const>(single)};
+  std::vector<double> s(3);
+
+  angles.push_back(MCL::CAngle(90, MCL::AF_Dd));
+  BOOST_TEST(angles.size() == 3);
+  BOOST_TEST(angles.at(0).degrees() == 30.0, boost::test_tools::tolerance(1e-12));
+
+  angles.sin(s);
+  BOOST_TEST(s[0] == 0.5, boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(s[2] == 1.0, boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(s[1] == sin(single[1]), boost::test_tools::tolerance(1e-15));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define TEST  // Used to exclude error reporting and avoid having to link GCL + others.
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "include/fraction.hpp"
+#include "include/fractionArray.hpp"
+#include "include/functions/gcdArray.hpp"
+
+BOOST_AUTO_TEST_SUITE(functions_gcdArray)
+
+  // Use several threads, irrespective of the machine, so that the block split is tested.
+
+struct threadFixture
+{
+  std::size_t savedThreads;
+
+  threadFixture() : savedThreads(MCL::maxThreads) { MCL::maxThreads = 4; }
+  ~threadFixture() { MCL::maxThreads = savedThreads; }
+};
+
+BOOST_FIXTURE_TEST_CASE(elementwise, threadFixture)
+{
+  std::mt19937_64 rng(1);
+  std::uniform_int_distribution<std::int64_t> dist(-1000000000, 1000000000);
+  std::vector<std::int64_t> A(5003), B(5003), G(5003), L(5003);
+
+  for (std::size_t i = 0; i < A.size(); i++)
+  {
+    A[i] = dist(rng) * (i % 7);
+    B[i] = dist(rng) * (i % 5);
+  }
+
+  MCL::gcd<std::int64_t>(A, B, G);
+  MCL::lcm<std::int64_t>(std::vector<std::int64_t>(A.size(), 6), std::vector<std::int64_t>(A.size(), -4), L);
+
+  for (std::size_t i = 0; i < A.size(); i++)
+  {
+    BOOST_TEST(G[i] == std::gcd(A[i], B[i]));
+  }
+  BOOST_TEST(L[17] == 12);
+
+  std::vector<std::int64_t> big = { std::int64_t{1} << 40, (std::int64_t{1} << 40) - 1 };
+  std::vector<std::int64_t> bigR(big.rbegin(), big.rend());
+  BOOST_CHECK_THROW(MCL::lcm<std::int64_t>(big, bigR, std::span<std::int64_t>(L.data(), 2)), std::overflow_error);
+
+  std::vector<std::int64_t> low = { std::numeric_limits<std::int64_t>::min(), 4 };
+  std::vector<std::int64_t> zero = { 0, -6 };
+  BOOST_CHECK_THROW(MCL::gcd<std::int64_t>(low, zero, std::span<std::int64_t>(G.data(), 2)), std::overflow_error);
+  low[0] = std::numeric_limits<std::int64_t>::min() + 2;
+  MCL::gcd<std::int64_t>(low, zero, std::span<std::int64_t>(G.data(), 2));
+  BOOST_TEST(G[0] == std::numeric_limits<std::int64_t>::max() - 1);
+  BOOST_TEST(G[1] == 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(reduction, threadFixture)
+{
+  std::vector<std::int32_t> X(10000);
+
+  for (std::size_t i = 0; i < X.size(); i++)
+  {
+    X[i] = static_cast<std::int32_t>((i % 97 + 1) * 36);
+  }
+
+  BOOST_TEST(MCL::gcd<std::int32_t>(X) == 36u);
+
+  std::vector<std::int64_t> D = { 4, 6, 10, -15, 9 };
+  BOOST_TEST(MCL::commonDenominator<std::int64_t>(D) == 180);
+
+  D.push_back(0);
+  BOOST_CHECK_THROW(MCL::commonDenominator<std::int64_t>(D), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(fractions, threadFixture)
+{
+  std::mt19937_64 rng(2);
+  std::uniform_int_distribution<std::int64_t> dist(-100000, 100000);
+  std::size_t const N = 4001;
+  std::vector<std::int64_t> nA(N), dA(N), nB(N), dB(N), nR(N), dR(N);
+
+  for (std::size_t i = 0; i < N; i++)
+  {
+    nA[i] = dist(rng);
+    dA[i] = dist(rng) | 1;
+    nB[i] = dist(rng);
+    dB[i] = dist(rng) | 1;
+  }
+
+  MCL::fractionReduce(nA, dA);
+  MCL::fractionReduce(nB, dB);
+
+  MCL::fractionAdd(nA, dA, nB, dB, nR, dR);
+  for (std::size_t i = 0; i < N; i++)
+  {
+    MCL::fraction_t f = MCL::fraction_t(nA[i], dA[i]) + MCL::fraction_t(nB[i], dB[i]);
+    BOOST_TEST(nR[i] == f.numerator());
+    BOOST_TEST(dR[i] == f.denominator());
+  }
+
+  MCL::fractionMultiply(nA, dA, nB, dB, nR, dR);
+  for (std::size_t i = 0; i < N; i++)
+  {
+    MCL::fraction_t f = MCL::fraction_t(nA[i], dA[i]) * MCL::fraction_t(nB[i], dB[i]);
+    BOOST_TEST(nR[i] == f.numerator());
+    BOOST_TEST(dR[i] == f.denominator());
+  }
+
+  std::vector<std::int64_t> zero = { 1, 0 };
+  BOOST_CHECK_THROW(MCL::fractionReduce(zero, zero), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
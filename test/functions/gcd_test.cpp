@@ -0,0 +1,77 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define TEST  // Used to exclude error reporting and avoid having to link GCL + others.
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "include/fraction.hpp"
+#include "include/functions/gcd.hpp"
+
+BOOST_AUTO_TEST_SUITE(functions_gcd)
+
+BOOST_AUTO_TEST_CASE(gcd)
+{
+  static_assert(MCL::gcd(12, 18) == 6);
+
+  BOOST_TEST(MCL::gcd(1071, 462) == 21);
+  BOOST_TEST(MCL::gcd(-1071, 462) == 21);
+  BOOST_TEST(MCL::gcd(17, 5) == 1);
+  BOOST_TEST(MCL::gcd(std::int64_t{1000000000000000000}, std::int64_t{1}) == 1);
+  BOOST_TEST(MCL::gcd(std::numeric_limits<std::int64_t>::min(), std::int64_t{6}) == 2);
+
+  BOOST_CHECK_THROW(MCL::gcd(0, 5), std::runtime_error);
+  BOOST_CHECK_THROW(MCL::gcd(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::min()),
+                    std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(fraction)
+{
+  using MCL::fraction_t;
+
+  constexpr fraction_t half = fraction_t(1, 2) + fraction_t(1, 3) - fraction_t(1, 3);
+  static_assert(half == fraction_t(2, 4));
+
+  fraction_t f(6, -8);
+  BOOST_TEST(f.numerator() == -3);
+  BOOST_TEST(f.denominator() == 4);
+
+  f = fraction_t(1, 2) - fraction_t(1, 2);
+  BOOST_TEST(f.numerator() == 0);
+  BOOST_TEST(f.denominator() == 1);
+
+  f = fraction_t(1, 6) + fraction_t(1, 10);
+  BOOST_TEST(f.numerator() == 4);
+  BOOST_TEST(f.denominator() == 15);
+
+  f = fraction_t(-3, 4) / fraction_t(-9, 8);
+  BOOST_TEST(f.numerator() == 2);
+  BOOST_TEST(f.denominator() == 3);
+
+  BOOST_CHECK_THROW(fraction_t(1, 0), std::invalid_argument);
+  BOOST_CHECK_THROW(fraction_t(1, 2) / fraction_t(0, 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(fraction_large)
+{
+  using MCL::fraction_t;
+
+  std::int64_t const big = std::int64_t{1} << 62;
+
+    // Intermediate products exceed 64 bits, but the reduced results do not.
+
+  fraction_t f = fraction_t(big, 3) * fraction_t(3, big);
+  BOOST_TEST(f.numerator() == 1);
+  BOOST_TEST(f.denominator() == 1);
+
+  f = fraction_t(1, big - 1) + fraction_t(1, big - 1);
+  BOOST_TEST(f.numerator() == 2);
+  BOOST_TEST(f.denominator() == big - 1);
+
+  BOOST_CHECK_THROW(fraction_t(big, 1) * fraction_t(4, 1), std::overflow_error);
+  BOOST_CHECK_THROW(fraction_t(1, big - 1) + fraction_t(1, big - 3), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "include/point2D.hpp"
+#include "include/TVector3D.hpp"
+#include "include/vectorN.hpp"
+
+BOOST_AUTO_TEST_SUITE(geometry)
+
+BOOST_AUTO_TEST_CASE(vector3D)
+{
+  using vector_t = MCL::TVector3D<double>;
+
+  static_assert(std::is_trivially_copyable_v<vector_t>);
+
+  constexpr vector_t a(1, 2, 3), b(4, 5, 6), c(0.5, 0.5, 0.5);
+  constexpr vector_t r = a + b * 2.0 - c;
+  constexpr vector_t f = MCL::madd(a, b, 2.0);
+
+  static_assert(r.x() == 8.5 && r.y() == 11.5 && r.z() == 14.5);
+  static_assert(f.x() == 9.0);
+  static_assert(a.dot(b) == 32.0);
+  static_assert(a.cross(b).x() == -3.0 && a.cross(b).y() == 6.0 && a.cross(b).z() == -3.0);
+
+  vector_t d;
+  BOOST_TEST(d.x() == 0.0);
+  BOOST_TEST(a[2] == 3.0);
+  BOOST_TEST(a.at(1) == 2.0);
+  BOOST_CHECK_THROW(a.at(3), std::out_of_range);
+  BOOST_TEST(vector_t(3, 4, 0).length() == 5.0);
+  BOOST_TEST(MCL::floor(vector_t(1.5, -1.5, 0)).y() == -2.0);
+
+  std::vector<vector_t> src = { a, b }, dest(2);
+  std::memcpy(dest.data(), src.data(), src.size() * sizeof(vector_t));
+  BOOST_TEST(dest[1].z() == 6.0);
+}
+
+BOOST_AUTO_TEST_CASE(point)
+{
+  using point_t = MCL::point2D<double>;
+
+  static_assert(std::is_trivially_copyable_v<point_t>);
+  static_assert(sizeof(point_t) == 2 * sizeof(double));
+
+  constexpr point_t a(1, 2), b(3, 4);
+  constexpr point_t r = a + b * 2 - a;
+
+  static_assert(r.x() == 6.0 && r.y() == 8.0);
+  static_assert((-a).x() == -1.0);
+  static_assert(MCL::madd(a, b, 0.5).y() == 4.0);
+
+  BOOST_TEST((b / 2).x() == 1.5);
+  BOOST_TEST((b / 0).x() == 0.0);
+
+  point_t p = a;
+  p -= p;
+  BOOST_TEST(p == point_t(0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(vectorN)
+{
+  using vector_t = MCL::vectorN<double, 4>;
+
+  static_assert(std::is_trivially_copyable_v<vector_t>);
+  static_assert(sizeof(vector_t) == 4 * sizeof(double));
+
+  constexpr vector_t a(1, 2, 3, 4), b(4, 3, 2, 1);
+  constexpr vector_t r = a + b * 2 - a;
+
+  static_assert(r == vector_t(8, 6, 4, 2));
+  static_assert(a.dot(b) == 20.0);
+  static_assert((-a)[3] == -4.0);
+
+  vector_t c;
+  BOOST_TEST(c[0] == 0.0);
+  c.set(5, 6, 7, 8);
+  BOOST_TEST(c[2] == 7.0);
+
+  std::vector<vector_t> v(3);
+  v[1] = std::move(c);
+  BOOST_TEST(v[1][3] == 8.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "include/io/columnFile.h"
+
+BOOST_AUTO_TEST_SUITE(columnFile)
+
+BOOST_AUTO_TEST_CASE(roundTrip)
+{
+  std::filesystem::path path = std::filesystem::temp_directory_path() / "MCL_columnFile_test.col";
+  std::vector<double> values(2500);
+
+  std::iota(values.begin(), values.end(), 1.0);
+  MCL::columnFileWrite(path, std::span<double const>(values), 1000);
+
+  MCL::columnFile_t file(path);
+
+  BOOST_TEST(file.type() == MCL::NT_double);
+  BOOST_TEST(file.size() == 2500);
+  BOOST_TEST(file.chunkCount() == 3);
+  BOOST_TEST(file.chunkLength(2) == 500);
+
+  MCL::summary_t summary = file.summary();
+  BOOST_TEST(summary.count() == 2500);
+  BOOST_TEST(summary.sum() == 2500.0 * 2501.0 / 2);
+  BOOST_TEST(*summary.mean() == 1250.5);
+  BOOST_TEST(*summary.variance() == 2500.0 * 2501.0 / 12, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(summary.min() == 1.0);
+  BOOST_TEST(summary.max() == 2500.0);
+
+  BOOST_TEST(file.summary(1).min() == 1001.0);
+  BOOST_TEST(file.summary(1, 3).count() == 1500);
+  BOOST_CHECK_THROW(file.summary(3), std::out_of_range);
+  BOOST_CHECK_THROW(file.summary(2, 4), std::out_of_range);
+
+  std::span<double const> chunk = file.view<double>(2);
+  BOOST_TEST(chunk.size() == 500);
+  BOOST_TEST(chunk.front() == 2001.0);
+  BOOST_TEST(chunk.back() == 2500.0);
+  BOOST_TEST(file.read<double>(0) == std::vector<double>(values.begin(), values.begin() + 1000),
+             boost::test_tools::per_element());
+  BOOST_CHECK_THROW(file.view<float>(0), std::invalid_argument);
+
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(column)
+{
+  std::filesystem::path path = std::filesystem::temp_directory_path() / "MCL_columnFile_test.col";
+  std::vector<std::int16_t> values = { 5, -3, 7 };
+
+  MCL::columnFileWrite(path, MCL::numericColumn_t(std::span<std::int16_t const>(values)), 2);
+
+  {
+    MCL::columnFile_t file(path);
+
+    BOOST_TEST(file.type() == MCL::NT_int16);
+    BOOST_TEST(file.read<std::int16_t>(1) == std::vector<std::int16_t>({ 7 }), boost::test_tools::per_element());
+    BOOST_TEST(file.summary().sum() == 9.0);
+    BOOST_TEST(file.summary().min() == -3.0);
+  };
+
+  MCL::columnFileWrite(path, std::span<float const>());
+  BOOST_TEST(MCL::columnFile_t(path).empty());
+  BOOST_TEST(!MCL::columnFile_t(path).summary().mean());
+
+  MCL::columnFileWrite(path, std::span<std::int16_t const>(values), std::numeric_limits<std::size_t>::max());
+  BOOST_TEST(MCL::columnFile_t(path).chunkCount() == 1);
+  BOOST_TEST(MCL::columnFile_t(path).summary().sum() == 9.0);
+
+  {
+    std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+    fs.seekp(16);
+    fs.write(std::string(8, '\0').data(), 8);
+  };
+  BOOST_CHECK_THROW(MCL::columnFile_t{ path }, std::runtime_error);
+
+  {
+    std::ofstream ofs(path, std::ios::binary);
+    ofs << "MCLCOLMN";
+  };
+  BOOST_CHECK_THROW(MCL::columnFile_t{ path }, std::runtime_error);
+
+  std::filesystem::remove(path);
+  BOOST_CHECK_THROW(MCL::columnFileWrite(path, std::span<double const>(), 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
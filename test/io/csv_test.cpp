@@ -0,0 +1,104 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "include/io/csv.hpp"
+
+BOOST_AUTO_TEST_SUITE(csv)
+
+  // A string converts to both a path and a span, so the text is passed explicitly as a span.
+
+static std::span<char const> asText(std::string_view text)
+{
+  return { text.data(), text.size() };
+}
+
+BOOST_AUTO_TEST_CASE(read)
+{
+  std::string text = "name,value\r\na, 1.5\r\n\r\nb,-2\nc ,  3e2  \n";
+
+  std::vector<double> values = MCL::csvRead<double>(asText(text), { 1, 1, ',' });
+  BOOST_TEST(values == std::vector<double>({ 1.5, -2.0, 300.0 }), boost::test_tools::per_element());
+
+  std::vector<std::int64_t> integers = MCL::csvRead<std::int64_t>(asText("7\n8\n9"));
+  BOOST_TEST(integers == std::vector<std::int64_t>({ 7, 8, 9 }), boost::test_tools::per_element());
+
+  BOOST_TEST(MCL::csvRead<double>(asText("")).empty());
+
+  BOOST_CHECK_THROW(MCL::csvRead<double>(asText("1\n2\nx\n")), std::runtime_error);
+  BOOST_CHECK_THROW(MCL::csvRead<double>(asText("1,2\n3\n"), { 1, 0, ',' }), std::runtime_error);
+  BOOST_CHECK_THROW(MCL::csvRead<int>(asText("1.5\n")), std::runtime_error);
+
+  try
+  {
+    MCL::csvRead<double>(asText("h\n1\n\n2\n?\n"), { 0, 1, ',' });
+  }
+  catch (std::runtime_error const &e)
+  {
+    BOOST_TEST(std::string(e.what()).find("line 5") != std::string::npos);
+  };
+}
+
+BOOST_AUTO_TEST_CASE(parallel)
+{
+  std::string text;
+  std::size_t const count = 400000;
+
+  text.reserve(count * 12);
+  for (std::size_t index = 0; index < count; index++)
+  {
+    text += std::to_string(index % 1000) + ";" + std::to_string(index) + "\n";
+  };
+
+  std::size_t savedThreads = MCL::maxThreads;
+  MCL::maxThreads = 4;
+
+  std::vector<std::int32_t> values = MCL::csvRead<std::int32_t>(asText(text), { 1, 0, ';' });
+  MCL::summary_t summary = MCL::csvSummary<double>(asText(text), { 1, 0, ';' });
+
+  MCL::maxThreads = savedThreads;
+
+  BOOST_TEST(values.size() == count);
+  bool ordered = true;
+  for (std::size_t index = 0; index < count; index++)
+  {
+    ordered = ordered && (values[index] == static_cast<std::int32_t>(index));
+  };
+  BOOST_TEST(ordered);
+
+  double n = static_cast<double>(count);
+  BOOST_TEST(summary.count() == count);
+  BOOST_TEST(summary.sum() == n * (n - 1) / 2);
+  BOOST_TEST(*summary.mean() == (n - 1) / 2, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(*summary.variance() == n * (n + 1) / 12, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(summary.min() == 0.0);
+  BOOST_TEST(summary.max() == n - 1);
+}
+
+BOOST_AUTO_TEST_CASE(file)
+{
+  std::filesystem::path path = std::filesystem::temp_directory_path() / "MCL_csv_test.csv";
+
+  {
+    std::ofstream ofs(path);
+    ofs << "x\n1\n2\n3\n4\n";
+  };
+
+  BOOST_TEST(MCL::csvRead<double>(path, { 0, 1, ',' }).size() == 4);
+  BOOST_TEST(*MCL::csvSummary<double>(path, { 0, 1, ',' }).variance() == 5.0 / 3.0, boost::test_tools::tolerance(1e-15));
+
+  MCL::mappedFile_t file(path);
+  MCL::mappedFile_t moved(std::move(file));
+  BOOST_TEST(file.empty());
+  BOOST_TEST(moved.size() == 10);
+
+  std::filesystem::remove(path);
+  BOOST_CHECK_THROW(MCL::mappedFile_t{ path }, std::system_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
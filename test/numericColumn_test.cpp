@@ -0,0 +1,77 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "include/numericColumn.h"
+#include "include/statistics/mean.hpp"
+
+BOOST_AUTO_TEST_SUITE(numericColumn)
+
+BOOST_AUTO_TEST_CASE(construct)
+{
+  std::vector<std::int16_t> values = { 1, -2, 300 };
+  MCL::numericColumn_t column(std::span<std::int16_t const>(values.data(), values.size()));
+
+  BOOST_TEST(column.type() == MCL::NT_int16);
+  BOOST_TEST(column.size() == 3);
+  BOOST_TEST(column.elementSize() == 2);
+  BOOST_TEST(static_cast<double>(column.at(2)) == 300.0);
+  BOOST_CHECK_THROW(column.at(3), std::out_of_range);
+  BOOST_CHECK_THROW(column.view<float>(), std::invalid_argument);
+
+  BOOST_TEST(column.push_back(4.0) == MCL::CS_OK);
+  BOOST_TEST(column.push_back(40000) == MCL::CS_RANGE);
+  BOOST_TEST(column.view<std::int16_t>()[3] == 4);
+  BOOST_TEST(column.view<std::int16_t>()[4] == 0);
+
+  MCL::numericColumn_t empty;
+  BOOST_TEST(empty.type() == MCL::NT_none);
+  BOOST_TEST(empty.push_back(1) == MCL::CS_NOVALUE);
+  BOOST_TEST(empty.empty());
+}
+
+BOOST_AUTO_TEST_CASE(view)
+{
+  MCL::numericColumn_t column(MCL::NT_double, 10000);
+  std::span<double> values = column.view<double>();
+
+  std::iota(values.begin(), values.end(), 1.0);
+
+  BOOST_TEST(*MCL::mean(values.data(), values.size()) == 5000.5);
+  BOOST_TEST(column.visit([](auto v) { return static_cast<double>(v.back()); }) == 10000.0);
+}
+
+BOOST_AUTO_TEST_CASE(convert)
+{
+  MCL::numericColumn_t column(MCL::NT_uint32, 5000);
+  std::span<std::uint32_t> values = column.view<std::uint32_t>();
+
+  std::iota(values.begin(), values.end(), 0);
+
+  MCL::numericColumn_t wide(MCL::NT_int64);
+  BOOST_TEST(column.convert(wide) == MCL::CS_OK);
+  BOOST_TEST(wide.size() == 5000);
+  BOOST_TEST(wide.view<std::int64_t>()[4999] == 4999);
+
+  MCL::numericColumn_t narrow(MCL::NT_uint8);
+  BOOST_TEST(column.convert(narrow) == MCL::CS_RANGE);
+  BOOST_TEST(narrow.view<std::uint8_t>()[255] == 255);
+  BOOST_TEST(narrow.view<std::uint8_t>()[256] == 0);
+
+  std::vector<float> f(5000);
+  BOOST_TEST(column.convert(std::span<float>(f)) == MCL::CS_OK);
+  BOOST_TEST(f[1234] == 1234.0f);
+
+    // Columns without a type.
+
+  MCL::numericColumn_t untyped;
+  BOOST_TEST(untyped.convert(wide) == MCL::CS_NOVALUE);
+  BOOST_TEST(wide.size() == 5000);
+  BOOST_TEST(column.convert(untyped) == MCL::CS_NOVALUE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,78 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define TEST  // Used to exclude error reporting and avoid having to link GCL + others.
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "include/numeric.h"
+
+BOOST_AUTO_TEST_SUITE(numeric)
+
+BOOST_AUTO_TEST_CASE(numericConvert)
+{
+  std::uint8_t u8;
+  std::int32_t i32;
+  float f;
+
+  static_assert([]() { std::uint8_t d = 0; return MCL::numericConvert(255, d); }() == MCL::CS_OK);
+
+  BOOST_TEST(MCL::numericConvert(256, u8) == MCL::CS_RANGE);
+  BOOST_TEST(u8 == 0);
+  BOOST_TEST(MCL::numericConvert(-1, u8) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(std::uint64_t{0xFFFFFFFF}, i32) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(2147483647.0, i32) == MCL::CS_OK);
+  BOOST_TEST(i32 == 2147483647);
+  BOOST_TEST(MCL::numericConvert(2147483648.0, i32) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(std::numeric_limits<double>::quiet_NaN(), i32) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(255.0, u8) == MCL::CS_OK);
+  BOOST_TEST(MCL::numericConvert(255.5, u8) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(2147483647.5, i32) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(-2147483648.5, i32) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(2147483520.0f, i32) == MCL::CS_OK);
+  BOOST_TEST(MCL::numericConvert(2147483648.0f, i32) == MCL::CS_RANGE);
+  BOOST_TEST(MCL::numericConvert(-1.5, f) == MCL::CS_OK);
+  BOOST_TEST(f == -1.5f);
+  BOOST_TEST(MCL::numericConvert(1e300, f) == MCL::CS_RANGE);
+}
+
+BOOST_AUTO_TEST_CASE(CNumeric_convert)
+{
+  MCL::CNumeric n(std::int16_t{-300});
+  std::int8_t i8;
+  std::int64_t i64;
+
+  BOOST_TEST(n.convert(i8) == MCL::CS_RANGE);
+  BOOST_TEST(n.convert(i64) == MCL::CS_OK);
+  BOOST_TEST(i64 == -300);
+  BOOST_TEST(static_cast<double>(n) == -300.0);
+  BOOST_TEST(static_cast<float>(MCL::CNumeric(-2.5)) == -2.5f);
+  BOOST_TEST(MCL::CNumeric().convert(i64) == MCL::CS_NOVALUE);
+
+    // Fractional values above the maximum are out of range. (operator std::uint8_t() throws.)
+
+  std::uint8_t u8;
+  BOOST_TEST(MCL::CNumeric(255.5).convert(u8) == MCL::CS_RANGE);
+}
+
+BOOST_AUTO_TEST_CASE(CNumeric_bulk)
+{
+  std::vector<MCL::CNumeric> homogeneous(1000, MCL::CNumeric(std::uint16_t{1000}));
+  std::vector<MCL::CNumeric> mixed = { MCL::CNumeric(std::uint8_t{1}), MCL::CNumeric(2.0f), MCL::CNumeric(std::int64_t{-3}) };
+  std::vector<std::int32_t> out(1000);
+  std::vector<std::uint8_t> small(1000);
+
+  BOOST_TEST(MCL::convert<std::int32_t>(homogeneous, out) == MCL::CS_OK);
+  BOOST_TEST(out[999] == 1000);
+  BOOST_TEST(MCL::convert<std::uint8_t>(homogeneous, small) == MCL::CS_RANGE);
+
+  BOOST_TEST(MCL::convert<std::int32_t>(mixed, out) == MCL::CS_OK);
+  BOOST_TEST(out[1] == 2);
+  BOOST_TEST(out[2] == -3);
+  BOOST_TEST(MCL::convert<std::uint8_t>(mixed, small) == MCL::CS_RANGE);
+  BOOST_TEST(small[2] == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
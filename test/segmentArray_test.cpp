@@ -0,0 +1,114 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "include/segmentArray.hpp"
+
+BOOST_AUTO_TEST_SUITE(segmentArray)
+
+BOOST_AUTO_TEST_CASE(atan2)
+{
+  std::vector<double> x(30000), y(x.size()), r(x.size());
+
+  for (std::size_t index = 0; index < x.size(); index++)
+  {
+    x[index] = std::cos(index * 0.001) * (1.0 + index);
+    y[index] = std::sin(index * 0.001) * (1.0 + index);
+  };
+  x[0] = y[0] = 0;
+  x[1] = -0.0;
+  y[2] = std::numeric_limits<double>::infinity();
+  x[3] = std::numeric_limits<double>::quiet_NaN();
+
+  MCL::atan2<double>(y, x, r);
+
+  for (std::size_t index = 4; index < x.size(); index++)
+  {
+    BOOST_TEST(r[index] == std::atan2(y[index], x[index]), boost::test_tools::tolerance(1e-15));
+  };
+  BOOST_TEST(r[0] == 0.0);
+  BOOST_TEST(r[1] == std::atan2(y[1], -0.0));
+  BOOST_TEST(r[2] == MCL::PI_DIV_2);
+  BOOST_TEST(std::isnan(r[3]));
+
+  std::vector<double> small(1);
+  BOOST_CHECK_THROW(MCL::atan2<double>(y, x, small), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(soa)
+{
+  std::vector<double> x1 = { 0, 0, 1, 0 }, y1 = { 0, 0, 1, 0 };
+  std::vector<double> x2 = { 1, -1, 1, 3 }, y2 = { 1, 0, -1, 4 };
+  MCL::segmentSpan_t<double> a(x1, y1, x2, y2);
+  std::vector<double> r(4);
+
+  MCL::segmentAngle(a, r);
+  BOOST_TEST(r[0] == MCL::PI / 4, boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(r[1] == MCL::PI, boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(r[2] == -MCL::PI_DIV_2, boost::test_tools::tolerance(1e-15));
+
+  MCL::segmentLength(a, r);
+  BOOST_TEST(r[3] == 5.0);
+
+  std::vector<double> bx1 = { 0, 0, 2, 0 }, by1 = { 1, 0, 0, 0 }, bx2 = { 1, 0, 3, 1 }, by2 = { 0, 1, 0, 0 };
+  MCL::segmentSpan_t<double> b(bx1, by1, bx2, by2);
+  std::vector<std::uint8_t> hit(4);
+
+  MCL::segmentDot(a, b, r);
+  BOOST_TEST(r[0] == 0.0);
+  BOOST_TEST(r[3] == 3.0);
+
+  MCL::segmentCross(a, b, r);
+  BOOST_TEST(r[0] == -2.0);
+  BOOST_TEST(r[3] == -4.0);
+
+    // 0: crossing diagonals. 1: touch at the origin. 2: no intersection. 3: touch at an end point.
+
+  BOOST_TEST(MCL::segmentIntersect(a, b, hit) == 3);
+  BOOST_TEST(hit == std::vector<std::uint8_t>({ 1, 1, 0, 1 }), boost::test_tools::per_element());
+
+  std::vector<double> shortArray(3);
+  BOOST_CHECK_THROW(MCL::segmentSpan_t<double>(shortArray, y1, x2, y2), std::invalid_argument);
+  BOOST_CHECK_THROW(MCL::segmentLength(a, std::span<double>(shortArray)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(aos)
+{
+  using point_t = MCL::point2D<double>;
+
+  std::vector<MCL::vector2P_t<double>> v(20000);
+  std::vector<double> r(v.size());
+
+  for (std::size_t index = 0; index < v.size(); index++)
+  {
+    double angle = index * 0.0003;
+    v[index] = MCL::vector2P_t<double>(point_t(1, 2), point_t(1 + std::cos(angle), 2 + std::sin(angle)));
+  };
+
+  MCL::segmentAngle(v, r);
+
+  for (std::size_t index = 0; index < v.size(); index += 37)
+  {
+    double expected = v[index].angle();
+
+    if (expected > MCL::PI)
+    {
+      expected -= MCL::PI_2;
+    };
+    BOOST_TEST(r[index] == expected, boost::test_tools::tolerance(1e-12));
+  };
+
+  MCL::segmentLength(v, r);
+  BOOST_TEST(r[1000] == 1.0, boost::test_tools::tolerance(1e-15));
+
+  MCL::vector2P_t<double> q(point_t(0, 0), point_t(-1, 1));
+  BOOST_TEST(q.angle() == 3 * MCL::PI / 4, boost::test_tools::tolerance(1e-15));
+  BOOST_TEST(MCL::vector2P_t<double>(point_t(0, 0), point_t(1, -1)).angle() == 7 * MCL::PI / 4,
+             boost::test_tools::tolerance(1e-15));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/angle.h"
+#include "include/sexagesimal.h"
+
+namespace
+{
+  std::string format(double value, MCL::sexagesimalFormat_e format, int precision)
+  {
+    char buffer[40];
+    std::to_chars_result result = MCL::sexagesimalToChars(buffer, buffer + sizeof(buffer), value, format, precision);
+
+    return (result.ec == std::errc()) ? std::string(buffer, result.ptr) : std::string("error");
+  }
+
+  double parse(std::string_view text, MCL::sexagesimalFormat_e format)
+  {
+    double value = 0;
+    std::from_chars_result result = MCL::sexagesimalFromChars(text.data(), text.data() + text.size(), value, format);
+
+    BOOST_TEST((result.ec == std::errc()));
+    BOOST_TEST((result.ptr == text.data() + text.size()));
+    return value;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(sexagesimal)
+
+BOOST_AUTO_TEST_CASE(toChars)
+{
+  BOOST_TEST(format(12.5, MCL::SF_SEPARATED, 2) == "12:30:00.00");
+  BOOST_TEST(format(-0.5, MCL::SF_SEPARATED, 0) == "-00:30:00");
+  BOOST_TEST(format(359.9999999, MCL::SF_SEPARATED, 2) == "360:00:00.00");     // Carry from the seconds.
+  BOOST_TEST(format(12.5 + 15.25 / 3600, MCL::SF_PACKED, 4) == "123015.2500");
+  BOOST_TEST(format(-1e-9, MCL::SF_SEPARATED, 2) == "00:00:00.00");
+  BOOST_TEST(format(std::nan(""), MCL::SF_SEPARATED, 2) == "error");
+  BOOST_TEST(format(1.0, MCL::SF_SEPARATED, 10) == "error");
+
+  char small[5];
+  BOOST_TEST((MCL::sexagesimalToChars(small, small + sizeof(small), 1.0).ec == std::errc::value_too_large));
+}
+
+BOOST_AUTO_TEST_CASE(fromChars)
+{
+  BOOST_TEST(parse("12:30:00.00", MCL::SF_SEPARATED) == 12.5);
+  BOOST_TEST(parse("-10:30:00", MCL::SF_SEPARATED) == -10.5);
+  BOOST_TEST(parse("123015.25", MCL::SF_PACKED) == 12.0 + 30.0 / 60 + 15.25 / 3600, boost::test_tools::tolerance(1e-15));
+
+  double value = 7;
+  std::string_view bad = "12:60:00";
+  BOOST_TEST((MCL::sexagesimalFromChars(bad.data(), bad.data() + bad.size(), value).ec == std::errc::result_out_of_range));
+  bad = "12-30";
+  BOOST_TEST((MCL::sexagesimalFromChars(bad.data(), bad.data() + bad.size(), value).ec == std::errc::invalid_argument));
+  BOOST_TEST(value == 7);
+}
+
+BOOST_AUTO_TEST_CASE(roundTrip)
+{
+  std::mt19937_64 generator(1);
+  std::uniform_real_distribution<double> distribution(-360, 360);
+
+  for (int count = 0; count < 10000; count++)
+  {
+    for (MCL::sexagesimalFormat_e f : { MCL::SF_SEPARATED, MCL::SF_PACKED })
+    {
+      std::string text = format(distribution(generator), f, 4);
+
+      BOOST_TEST(format(parse(text, f), f, 4) == text);
+    };
+  };
+}
+
+BOOST_AUTO_TEST_CASE(bulk)
+{
+  std::vector<double> values = { 1.5, -2.25, 300.125 };
+  std::vector<double> parsed(3);
+  char buffer[64];
+
+  std::to_chars_result result = MCL::sexagesimalToChars(buffer, buffer + sizeof(buffer), values, MCL::SF_SEPARATED, 2, ' ');
+  BOOST_TEST((result.ec == std::errc()));
+  BOOST_TEST(std::string(buffer, result.ptr) == "01:30:00.00 -02:15:00.00 300:07:30.00 ");
+
+  std::from_chars_result parseResult = MCL::sexagesimalFromChars(buffer, result.ptr, parsed, MCL::SF_SEPARATED, ' ');
+  BOOST_TEST((parseResult.ec == std::errc()));
+  BOOST_TEST(parsed == values, boost::test_tools::per_element());
+
+  BOOST_TEST((MCL::sexagesimalToChars(buffer, buffer + 20, values, MCL::SF_SEPARATED, 2, ' ').ec == std::errc::value_too_large));
+}
+
+BOOST_AUTO_TEST_CASE(CAngle)
+{
+  MCL::CAngle dec(-103015.5, MCL::AF_DMSs);
+  MCL::CAngle ra(123000.0, MCL::AF_HMSs);
+
+  BOOST_TEST(dec.A2SDMS() == "-10:30:15.50");
+  BOOST_TEST(ra.A2SHMS() == "12:30:00.00");
+  BOOST_TEST(ra.degrees() == 187.5, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(MCL::CAngle(30, MCL::AF_Dd).A2SD() == "30.000000");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
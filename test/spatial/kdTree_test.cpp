@@ -0,0 +1,120 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "include/spatial/kdTree.hpp"
+
+namespace
+{
+  template<typename P>
+  double distance2(P const &lhs, P const &rhs)
+  {
+    double returnValue = 0;
+
+    for (std::size_t axis = 0; axis < MCL::pointTraits<P>::DIMENSIONS; axis++)
+    {
+      double d = MCL::pointTraits<P>::coordinate(lhs, axis) - MCL::pointTraits<P>::coordinate(rhs, axis);
+      returnValue += d * d;
+    };
+
+    return returnValue;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(kdTree)
+
+BOOST_AUTO_TEST_CASE(nearest2D)
+{
+  using point_t = MCL::point2D<double>;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+  std::vector<point_t> points(5000), queries(200);
+
+  for (point_t &point : points)
+  {
+    point = point_t(distribution(generator), distribution(generator));
+  };
+  for (point_t &query : queries)
+  {
+    query = point_t(distribution(generator), distribution(generator));
+  };
+
+  MCL::kdTree_t<point_t> tree(points);
+  std::vector<std::size_t> batch = tree.nearest(std::span<point_t const>(queries), 5);
+
+  BOOST_TEST(tree.size() == points.size());
+  BOOST_TEST(batch.size() == queries.size() * 5);
+
+  for (std::size_t query = 0; query < queries.size(); query++)
+  {
+    std::vector<std::size_t> expected(points.size());
+    for (std::size_t index = 0; index < points.size(); index++)
+    {
+      expected[index] = index;
+    };
+    std::partial_sort(expected.begin(), expected.begin() + 5, expected.end(), [&](std::size_t lhs, std::size_t rhs)
+    {
+      return distance2(queries[query], points[lhs]) < distance2(queries[query], points[rhs]);
+    });
+    expected.resize(5);
+
+    std::vector<std::size_t> found = tree.nearest(queries[query], 5);
+
+    BOOST_TEST(found == expected, boost::test_tools::per_element());
+    BOOST_TEST(std::vector<std::size_t>(batch.begin() + query * 5, batch.begin() + query * 5 + 5) == expected,
+               boost::test_tools::per_element());
+  };
+
+  BOOST_TEST(MCL::kdTree_t<point_t>(std::span<point_t const>(points.data(), 3)).nearest(queries[0], 5).size() == 3);
+  BOOST_TEST(MCL::kdTree_t<point_t>().nearest(queries[0], 5).empty());
+}
+
+BOOST_AUTO_TEST_CASE(range3D)
+{
+  using vector_t = MCL::TVector3D<double>;
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(0.0, 10.0);
+  std::vector<vector_t> points(30000);
+
+  for (vector_t &point : points)
+  {
+    point = vector_t(distribution(generator), distribution(generator), distribution(generator));
+  };
+
+  MCL::kdTree_t<vector_t> tree(points);
+  vector_t centre(5, 5, 5), lower(2, 3, 4), upper(4, 6, 5);
+  std::vector<std::size_t> expectedRadius, expectedBox;
+
+  for (std::size_t index = 0; index < points.size(); index++)
+  {
+    if (distance2(centre, points[index]) <= 1.5 * 1.5)
+    {
+      expectedRadius.push_back(index);
+    };
+    if ( (points[index].x() >= 2) && (points[index].x() <= 4) && (points[index].y() >= 3) && (points[index].y() <= 6) &&
+         (points[index].z() >= 4) && (points[index].z() <= 5) )
+    {
+      expectedBox.push_back(index);
+    };
+  };
+
+  std::vector<std::size_t> found = tree.radius(centre, 1.5);
+  std::sort(found.begin(), found.end());
+  BOOST_TEST(found == expectedRadius, boost::test_tools::per_element());
+
+  std::vector<vector_t> queries = { centre, lower };
+  std::vector<std::vector<std::size_t>> batch = tree.radius(std::span<vector_t const>(queries), 1.5);
+  std::sort(batch[0].begin(), batch[0].end());
+  BOOST_TEST(batch[0] == expectedRadius, boost::test_tools::per_element());
+
+  found = tree.box(lower, upper);
+  std::sort(found.begin(), found.end());
+  BOOST_TEST(found == expectedBox, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "boost/math/distributions.hpp"
+
+#include "include/statistics/distributionFunctions/cdf.hpp"
+
+namespace
+{
+  /// @brief Evaluates a distribution with MCL (double and float) and boost, and checks the relative differences.
+
+  template<typename D>
+  void compare(MCL::PDF_e PDF, std::vector<double> const &parameters, D const &distribution, std::vector<double> const &x)
+  {
+    std::vector<double> cdf(x.size());
+    std::vector<float> xf(x.begin(), x.end());
+    std::vector<float> cdff(x.size());
+
+    MCL::distributionCDF(PDF, std::span<double const>(parameters), std::span<double const>(x), std::span<double>(cdf));
+    MCL::distributionCDF(PDF, std::span<double const>(parameters), std::span<float const>(xf), std::span<float>(cdff));
+
+    for (std::size_t index = 0; index < x.size(); index++)
+    {
+      double expected = boost::math::cdf(distribution, x[index]);
+
+      BOOST_TEST(cdf[index] == expected, boost::test_tools::tolerance(1e-13));
+      BOOST_TEST(cdff[index] == static_cast<float>(boost::math::cdf(distribution, static_cast<double>(xf[index]))),
+                 boost::test_tools::tolerance(1e-5f));
+    };
+
+    std::vector<double> p = { 1e-12, 0.001, 0.05, 0.3, 0.5, 0.8, 0.975, 0.999999 };
+    std::vector<double> quantile(p.size());
+
+    MCL::distributionQuantile(PDF, std::span<double const>(parameters), std::span<double const>(p),
+                              std::span<double>(quantile));
+    for (std::size_t index = 0; index < p.size(); index++)
+    {
+      BOOST_TEST(quantile[index] == boost::math::quantile(distribution, p[index]), boost::test_tools::tolerance(1e-12));
+    };
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(statistics_distributionFunctions_cdf)
+
+BOOST_AUTO_TEST_CASE(distributions)
+{
+  compare(MCL::PDF_NORMAL, { 3, 2 }, boost::math::normal_distribution<double>(3, 2), { -8, -1, 0.5, 3, 4.2, 9, 15 });
+  compare(MCL::PDF_LOGNOMRMAL, { 0.5, 0.75 }, boost::math::lognormal_distribution<double>(0.5, 0.75),
+          { 0.01, 0.3, 1, 1.65, 4, 20 });
+  compare(MCL::PDF_EXPONENTIAL, { 0.25 }, boost::math::exponential_distribution<double>(0.25), { 1e-6, 0.5, 4, 12, 60 });
+  compare(MCL::PDF_WEIBULL, { 1.7, 30 }, boost::math::weibull_distribution<double>(1.7, 30), { 0.5, 10, 30, 55, 120 });
+  compare(MCL::PDF_GAMMA, { 3.5, 2 }, boost::math::gamma_distribution<double>(3.5, 2), { 0.1, 2, 7, 15, 40 });
+  compare(MCL::PDF_CHI_SQUARE, { 7 }, boost::math::chi_squared_distribution<double>(7), { 0.2, 3, 7, 14, 30 });
+}
+
+BOOST_AUTO_TEST_CASE(normalTails, *boost::unit_test::tolerance(1e-14))
+{
+  for (double p : { 1e-300, 1e-100, 1e-20, 1e-8, 0.02, 0.1, 0.4999 })
+  {
+    BOOST_TEST(MCL::normalQuantile(p, 0, 1) == boost::math::quantile(boost::math::normal_distribution<double>(), p));
+  };
+  for (double p : { 1e-12, 1e-8, 0.02, 0.1, 0.4999 })
+  {
+    BOOST_TEST(MCL::normalQuantile(1 - p, 0, 1) ==
+               boost::math::quantile(boost::math::normal_distribution<double>(), 1 - p));
+  };
+
+  BOOST_TEST(MCL::normalQuantile(0.5, 0, 1) == 0, boost::test_tools::tolerance(0.0));
+  BOOST_TEST(std::isinf(MCL::normalQuantile(0, 0, 1)));
+  BOOST_TEST(std::isnan(MCL::normalQuantile(1.5, 0, 1)));
+  BOOST_TEST(MCL::lognormalCDF(-1, 0, 1) == 0);
+  BOOST_TEST(MCL::exponentialCDF(-1, 2) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(errors)
+{
+  std::vector<double> x(3), result(3), parameters = { 1 };
+
+  BOOST_CHECK_THROW(MCL::distributionCDF(MCL::PDF_NORMAL, std::span<double const>(parameters), std::span<double const>(x),
+                                         std::span<double>(result)), std::runtime_error);
+  BOOST_CHECK_THROW(MCL::normalCDF(std::span<double const>(x), 0.0, 1.0, std::span<double>(result).first(2)),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
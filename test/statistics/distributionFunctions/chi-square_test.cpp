@@ -0,0 +1,131 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "boost/math/distributions/chi_squared.hpp"
+#include "boost/math/special_functions/gamma.hpp"
+
+#include "include/statistics/distributionFunctions/chi-square.h"
+#include "include/statistics/histogram.h"
+
+BOOST_AUTO_TEST_SUITE(statistics_distributionFunctions_chiSquare)
+
+BOOST_AUTO_TEST_CASE(incompleteGamma, *boost::unit_test::tolerance(1e-13))
+{
+  for (double a : { 0.1, 0.5, 1.0, 2.5, 10.0, 45.0 })
+  {
+    for (double x : { 0.01, 0.5, 1.0, 3.0, 9.5, 30.0, 60.0 })
+    {
+      BOOST_TEST(MCL::gammaP(a, x) == boost::math::gamma_p(a, x));
+      BOOST_TEST(MCL::gammaQ(a, x) == boost::math::gamma_q(a, x));
+    };
+    BOOST_TEST(MCL::gammaPInverse(a, 0.3) == boost::math::gamma_p_inv(a, 0.3));
+    BOOST_TEST(MCL::gammaPInverse(a, 0.999) == boost::math::gamma_p_inv(a, 0.999));
+    BOOST_TEST(MCL::logGamma(a) == std::lgamma(a));
+  };
+
+  BOOST_TEST(MCL::gammaP(2.0, 0.0) == 0);
+  BOOST_TEST(MCL::gammaQ(2.0, std::numeric_limits<double>::infinity()) == 0);
+  BOOST_TEST(std::isnan(MCL::gammaP(-1.0, 2.0)));
+
+    // The span version agrees with the scalar version on both sides of x = a + 1.
+
+  std::vector<double> x = { 0.1, 12, 0.7, 3.9, 25, 4.1, 0.0, 8, 5, 1e-3, 40 };
+  std::vector<double> p(x.size());
+
+  MCL::gammaP(4.0, std::span<double const>(x), std::span<double>(p));
+  for (std::size_t index = 0; index < x.size(); index++)
+  {
+    BOOST_TEST(p[index] == MCL::gammaP(4.0, x[index]));
+  };
+}
+
+BOOST_AUTO_TEST_CASE(distribution, *boost::unit_test::tolerance(1e-13))
+{
+  for (double k : { 1.0, 2.0, 5.0, 30.0 })
+  {
+    boost::math::chi_squared chiSquared(k);
+
+    for (double x : { 0.2, 1.0, 4.5, 20.0 })
+    {
+      BOOST_TEST(MCL::chiSquarePDF(x, k) == boost::math::pdf(chiSquared, x));
+      BOOST_TEST(MCL::chiSquareCDF(x, k) == boost::math::cdf(chiSquared, x));
+      BOOST_TEST(MCL::chiSquareSF(x, k) == boost::math::cdf(boost::math::complement(chiSquared, x)));
+    };
+    BOOST_TEST(MCL::chiSquareQuantile(0.95, k) == boost::math::quantile(chiSquared, 0.95));
+  };
+
+  BOOST_TEST(MCL::chiSquarePDF(0, 2) == 0.5);
+  BOOST_TEST(MCL::chiSquarePDF(-1, 2) == 0);
+
+  std::vector<float> x = { 0.5f, 2.0f, 7.0f };
+  std::vector<float> cdf(x.size());
+  MCL::chiSquareCDF(std::span<float const>(x), 3.0f, std::span<float>(cdf));
+  BOOST_TEST(cdf[1] == static_cast<float>(MCL::chiSquareCDF(2.0, 3.0)));
+
+  std::vector<double> statistics = { 3.5, 11.07, 0.0 };
+  std::vector<double> dof = { 5, 5, 1 };
+  std::vector<double> pValues(statistics.size());
+  MCL::chiSquareSF(std::span<double const>(statistics), std::span<double const>(dof), std::span<double>(pValues));
+  BOOST_TEST(pValues[1] == MCL::chiSquareSF(11.07, 5.0));
+  BOOST_TEST(pValues[2] == 1.0);
+
+  BOOST_CHECK_THROW(MCL::chiSquareSF(std::span<double const>(statistics), std::span<double const>(dof).first(2),
+                                     std::span<double>(pValues)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(tests, *boost::unit_test::tolerance(1e-12))
+{
+  std::vector<int> observed = { 16, 18, 16, 14, 12, 12 };
+  std::vector<double> expected = { 16, 16, 16, 16, 16, 8 };
+
+  MCL::chiSquareTest_t pearson = MCL::pearsonTest(std::span<int const>(observed), std::span<double const>(expected));
+  BOOST_TEST(pearson.statistic == 3.5);
+  BOOST_TEST(pearson.degreesOfFreedom == 5);
+  BOOST_TEST(pearson.pValue == 0.62338762774958223);
+
+    // Probabilities are scaled to the observed total.
+
+  std::vector<double> uniform(6, 1.0 / 6);
+  MCL::chiSquareTest_t g = MCL::gTest(std::span<int const>(observed), std::span<double const>(uniform));
+  BOOST_TEST(g.statistic == 2.006573162632538);
+  BOOST_TEST(g.pValue == MCL::chiSquareSF(2.006573162632538, 5));
+
+  MCL::chiSquareTest_t fitted = MCL::pearsonTest(std::span<int const>(observed), std::span<double const>(uniform), 2);
+  BOOST_TEST(fitted.degreesOfFreedom == 3);
+
+  std::vector<double> zero = { 1, 1, 0, 1, 1, 1 };
+  BOOST_TEST(MCL::pearsonTest(std::span<int const>(observed), std::span<double const>(zero)).pValue == 0);
+
+  BOOST_CHECK_THROW(MCL::pearsonTest(std::span<int const>(observed), std::span<double const>(expected).first(5)),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(MCL::gTest(std::span<int const>(observed), std::span<double const>(expected), 5), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(histogram)
+{
+    // The counts of a histogram are passed directly.
+
+  std::vector<double> data;
+  for (int value = 0; value < 600; value++)
+  {
+    data.push_back(value % 6 + 0.5);
+  };
+
+  MCL::histogram_t histogram(0, 6, 6);
+  histogram.fill(std::span<double const>(data));
+
+  std::vector<double> uniform(6, 1.0);
+  MCL::chiSquareTest_t result = MCL::pearsonTest(histogram.counts(), std::span<double const>(uniform));
+
+  BOOST_TEST(result.statistic == 0);
+  BOOST_TEST(result.pValue == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
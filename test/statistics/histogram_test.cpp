@@ -0,0 +1,159 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "include/statistics/histogram.h"
+
+BOOST_AUTO_TEST_SUITE(statistics_histogram)
+
+BOOST_AUTO_TEST_CASE(fixedWidth)
+{
+  std::vector<double> data = { -1, 0, 0.5, 1, 2.5, 9.99, 10, 11, std::numeric_limits<double>::quiet_NaN() };
+  MCL::histogram_t histogram(0, 10, 10);
+
+  histogram.fill(std::span<double const>(data));
+
+  BOOST_TEST(histogram.bins() == 10);
+  BOOST_TEST(histogram.fixedWidth());
+  BOOST_TEST(histogram.counts()[0] == 2);
+  BOOST_TEST(histogram.counts()[1] == 1);
+  BOOST_TEST(histogram.counts()[2] == 1);
+  BOOST_TEST(histogram.counts()[9] == 2);         // The last bin includes the upper edge.
+  BOOST_TEST(histogram.underflow() == 1);
+  BOOST_TEST(histogram.overflow() == 1);
+  BOOST_TEST(histogram.nan() == 1);
+  BOOST_TEST(histogram.total() == data.size());
+
+  BOOST_CHECK_THROW(MCL::histogram_t(1, 1, 10), std::invalid_argument);
+  BOOST_CHECK_THROW(MCL::histogram_t(0, 1, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(variableEdges)
+{
+  std::vector<double> edges = { 0, 1, 2, 5, 10, 100 };
+  std::vector<int> data;
+
+  for (int value = -5; value <= 105; value++)
+  {
+    data.push_back(value);
+  };
+
+  MCL::histogram_t histogram(edges);
+  histogram.fill(std::span<int const>(data));
+
+  std::vector<std::uint64_t> expected = { 1, 1, 3, 5, 91 };
+  BOOST_TEST(std::vector<std::uint64_t>(histogram.counts().begin(), histogram.counts().end()) == expected,
+             boost::test_tools::per_element());
+  BOOST_TEST(histogram.underflow() == 5);
+  BOOST_TEST(histogram.overflow() == 5);
+
+    // Single values agree with the block search.
+
+  MCL::histogram_t single(edges);
+  for (int value : data)
+  {
+    single.add(value);
+  };
+  BOOST_TEST((single == histogram));
+
+  BOOST_CHECK_THROW(MCL::histogram_t(std::vector<double>{ 0, 1, 1 }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(largeFill)
+{
+    // Enough values for several threads. Each value is counted exactly once.
+
+  std::vector<float> data(1000003);
+  for (std::size_t index = 0; index < data.size(); index++)
+  {
+    data[index] = static_cast<float>(index % 1000);
+  };
+
+  MCL::histogram_t fixed(0, 1000, 100);
+  fixed.fill(std::span<float const>(data));
+
+  MCL::histogram_t variable(std::vector<double>(fixed.edges().begin(), fixed.edges().end()));
+  variable.fill(std::span<float const>(data));
+
+  BOOST_TEST(fixed.total() == data.size());
+  BOOST_TEST(fixed.counts()[0] == 10003);
+  BOOST_TEST(fixed.counts()[99] == 10000);
+  BOOST_TEST(std::vector<std::uint64_t>(fixed.counts().begin(), fixed.counts().end()) ==
+             std::vector<std::uint64_t>(variable.counts().begin(), variable.counts().end()), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(freedmanDiaconis)
+{
+  std::vector<double> data;
+  for (int value = 1; value <= 1000; value++)
+  {
+    data.push_back(value);
+  };
+  data.push_back(std::numeric_limits<double>::quiet_NaN());
+
+    // IQR = 500, width = 1000 / 1000^(1/3) = 100.
+
+  MCL::histogram_t histogram = MCL::histogram_t::freedmanDiaconis(std::span<double const>(data));
+
+  BOOST_TEST(histogram.bins() == 10);
+  BOOST_TEST(histogram.edges().front() == 1);
+  BOOST_TEST(histogram.edges().back() == 1000);
+
+  histogram.fill(std::span<double const>(data));
+  BOOST_TEST(histogram.total() == 1001);
+  BOOST_TEST(histogram.nan() == 1);
+
+  BOOST_TEST(MCL::histogram_t::freedmanDiaconis(std::span<double const>(data), 4).bins() == 4);
+
+  std::vector<double> constant(10, 3.0);
+  BOOST_TEST(MCL::histogram_t::freedmanDiaconis(std::span<double const>(constant)).bins() == 1);
+
+  std::vector<double> empty;
+  BOOST_CHECK_THROW(MCL::histogram_t::freedmanDiaconis(std::span<double const>(empty)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(mergeAndSerialise)
+{
+  std::vector<double> first = { 0.5, 1.5, 1.7, -3 };
+  std::vector<double> second = { 2.5, 1.1, 7 };
+
+  MCL::histogram_t a(0, 3, 3);
+  MCL::histogram_t b(0, 3, 3);
+  MCL::histogram_t all(0, 3, 3);
+
+  a.fill(std::span<double const>(first));
+  b.fill(std::span<double const>(second));
+  all.fill(std::span<double const>(first));
+  all.fill(std::span<double const>(second));
+  a.merge(b);
+
+  BOOST_TEST((a == all));
+  BOOST_CHECK_THROW(a.merge(MCL::histogram_t(0, 3, 4)), std::invalid_argument);
+
+  std::stringstream stream;
+  a.serialise(stream);
+  MCL::histogram_t read = MCL::histogram_t::deserialise(stream);
+  BOOST_TEST((read == a));
+
+  MCL::histogram_t variable(std::vector<double>{ 0, 0.1, 2.5 });
+  variable.fill(std::span<double const>(first));
+  std::stringstream variableStream;
+  variable.serialise(variableStream);
+  BOOST_TEST((MCL::histogram_t::deserialise(variableStream) == variable));
+
+  std::string truncated = stream.str().substr(0, 60);
+  std::istringstream truncatedStream(truncated);
+  BOOST_CHECK_THROW(MCL::histogram_t::deserialise(truncatedStream), std::runtime_error);
+
+  a.clear();
+  BOOST_TEST(a.total() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
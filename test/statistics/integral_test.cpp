@@ -0,0 +1,87 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <valarray>
+#include <vector>
+
+#include "include/statistics/integral.hpp"
+#include "include/statistics/mean.hpp"
+#include "include/statistics/sum.hpp"
+#include "include/statistics/variance.hpp"
+
+BOOST_AUTO_TEST_SUITE(statistics_integral)
+
+BOOST_AUTO_TEST_CASE(exactSum)
+{
+  std::valarray<int> data = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 1811 };
+  BOOST_TEST(MCL::sum(data) == 1866);
+
+    // 2^60 + 1 repeated: the floating point sum loses the ones.
+
+  std::valarray<std::int64_t> big(static_cast<std::int64_t>((1LL << 60) + 1), 7);
+  big[6] = -(1LL << 60) * 6;
+  BOOST_TEST(MCL::sum(big) == 6);
+
+  std::vector<std::int64_t> values(100000);
+  for (std::size_t index = 0; index < values.size(); index++)
+  {
+    values[index] = (index % 2 == 0) ? std::numeric_limits<std::int64_t>::max() : std::numeric_limits<std::int64_t>::min() + 1;
+  };
+  BOOST_TEST(static_cast<std::int64_t>(MCL::detail::integralSum(values.data(), values.size())) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(exactMean)
+{
+  std::vector<std::int32_t> values(1001);
+  for (std::size_t index = 0; index < values.size(); index++)
+  {
+    values[index] = 2000000000 + static_cast<std::int32_t>(index);
+  };
+
+  BOOST_TEST(*MCL::mean(values.data(), values.size()) == 2000000500.0);
+
+  std::valarray<std::uint8_t> bytes(std::uint8_t(255), 3);
+  BOOST_TEST(MCL::mean(bytes) == 255.0);
+}
+
+BOOST_AUTO_TEST_CASE(exactVariance)
+{
+    // A large offset cancels catastrophically in the single-pass floating point formula.
+
+  std::vector<std::int64_t> offset = { 1000000000000004, 1000000000000007, 1000000000000013, 1000000000000016 };
+  BOOST_TEST(*MCL::variance(offset.data(), offset.size()) == 30.0);
+
+  std::valarray<std::int32_t> values = { 2000000001, 2000000002, 2000000003, 2000000004, 2000000005 };
+  BOOST_TEST(MCL::variance(values) == 2.5);
+
+    // The squares of these values do not fit in int64_t.
+
+  std::vector<std::uint32_t> unsigned32 = { 4000000000u, 4000000001u, 4000000003u, 4294967295u };
+  MCL::detail::integralMoments_t moments = MCL::detail::integralMoments(unsigned32.data(), unsigned32.size());
+  MCL::detail::uint128_t sumSquares = 0;
+
+  for (std::uint32_t value : unsigned32)
+  {
+    sumSquares += static_cast<MCL::detail::uint128_t>(value) * value;
+  };
+  BOOST_TEST((moments.sumSquares == sumSquares));
+  BOOST_TEST(*MCL::variance(unsigned32.data(), 3) == 7.0 / 3.0, boost::test_tools::tolerance(1e-12));
+
+  std::vector<std::int16_t> shorts = { -32768, 32767, -32768, 32767 };
+  BOOST_TEST(*MCL::variance(shorts.data(), shorts.size()) == 65535.0 * 65535.0 / 3.0);
+}
+
+BOOST_AUTO_TEST_CASE(overflowFallback, *boost::unit_test::tolerance(1e-12))
+{
+    // n * sum(x^2) for these values does not fit in 128 bits, so the floating point kernel is used.
+
+  std::int64_t const extreme = std::numeric_limits<std::int64_t>::max();
+  std::vector<std::int64_t> values = { extreme, -extreme, extreme, -extreme };
+
+  BOOST_TEST(!MCL::detail::integralVariance(MCL::detail::integralMoments(values.data(), values.size())));
+  BOOST_TEST(*MCL::variance(values.data(), values.size()) / (static_cast<double>(extreme) * static_cast<double>(extreme)) == 4.0 / 3.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
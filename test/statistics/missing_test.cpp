@@ -0,0 +1,114 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define TEST  // Used to exclude error reporting and avoid having to link GCL + others.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "include/functions/linearRegression.hpp"
+#include "include/statistics/missing.hpp"
+
+namespace
+{
+  double const NaN = std::numeric_limits<double>::quiet_NaN();
+}
+
+BOOST_AUTO_TEST_SUITE(statistics_missing)
+
+BOOST_AUTO_TEST_CASE(reductions, *boost::unit_test::tolerance(1e-12))
+{
+  std::vector<double> data = { 1, NaN, 2, -999, 3, 4, NaN, 5 };
+  std::span<double const> values(data);
+
+  MCL::missing_t skip{ .policy = MCL::MISSING_SKIP };
+  MCL::missing_t sentinel{ .policy = MCL::MISSING_SENTINEL, .sentinel = -999 };
+  MCL::missing_t propagate{ .policy = MCL::MISSING_PROPAGATE };
+
+  BOOST_TEST(MCL::summary(values, skip).count() == 6);
+  BOOST_TEST(MCL::sum(values, skip) == -984);
+
+  BOOST_TEST(MCL::summary(values, sentinel).count() == 5);
+  BOOST_TEST(MCL::sum(values, sentinel) == 15);
+  BOOST_TEST(*MCL::mean(values, sentinel) == 3);
+  BOOST_TEST(*MCL::variance(values, sentinel) == 2.5);
+  BOOST_TEST(*MCL::stdev(values, sentinel) == std::sqrt(2.5));
+  BOOST_TEST(MCL::minmax(values, sentinel)->first == 1);
+  BOOST_TEST(MCL::minmax(values, sentinel)->second == 5);
+
+  BOOST_TEST(std::isnan(MCL::sum(values, propagate)));
+  BOOST_TEST(std::isnan(*MCL::mean(values, propagate)));
+  BOOST_TEST(std::isnan(MCL::minmax(values, propagate)->first));
+  BOOST_TEST(std::isnan(MCL::minmax(values, propagate)->second));
+  BOOST_TEST(std::isnan(MCL::summary(values, propagate).max()));
+
+    // +inf and -inf give a NaN sum, but are not missing.
+
+  double const inf = std::numeric_limits<double>::infinity();
+  std::vector<double> infinities = { -inf, 1, NaN, inf };
+
+  BOOST_TEST((MCL::minmax(std::span<double const>(infinities), skip)->first == -inf));
+  BOOST_TEST((MCL::minmax(std::span<double const>(infinities), skip)->second == inf));
+  BOOST_TEST(std::isnan(MCL::minmax(std::span<double const>(infinities), propagate)->first));
+  infinities[2] = 2;
+  BOOST_TEST((MCL::minmax(std::span<double const>(infinities), propagate)->first == -inf));
+  BOOST_TEST((MCL::minmax(std::span<double const>(infinities), propagate)->second == inf));
+
+    // Validity mask: values 0, 2 and 4 only.
+
+  std::uint64_t mask[] = { 0b10101 };
+  MCL::missing_t masked{ .policy = MCL::MISSING_PROPAGATE, .validity = mask };
+
+  BOOST_TEST(MCL::sum(values, masked) == 6);
+  BOOST_TEST(*MCL::median(values, masked) == 2);
+
+  std::uint64_t empty[] = { 0 };
+  BOOST_TEST(!MCL::mean(values, MCL::missing_t{ .validity = empty }));
+  BOOST_CHECK_THROW(MCL::sum(std::span<double const>(std::vector<double>(65)), masked), std::invalid_argument);
+
+    // Integral values have no NaN.
+
+  std::vector<int> integers = { 4, -1, 6, -1, 2 };
+  BOOST_TEST(MCL::sum(std::span<int const>(integers), MCL::missing_t{ .policy = MCL::MISSING_SENTINEL, .sentinel = -1 }) == 12);
+}
+
+BOOST_AUTO_TEST_CASE(orderStatistics, *boost::unit_test::tolerance(1e-12))
+{
+  std::vector<double> data = { 5, NaN, 1, 4, -999, NaN, 2, 3 };
+  std::span<double const> values(data);
+
+  MCL::missing_t sentinel{ .policy = MCL::MISSING_SENTINEL, .sentinel = -999 };
+
+  BOOST_TEST(*MCL::median(values, sentinel) == 3);
+  BOOST_TEST(*MCL::median(values, MCL::missing_t{}) == 2.5);
+  BOOST_TEST(*MCL::percentile(values, 0.0, sentinel) == 1);
+  BOOST_TEST(*MCL::percentile(values, 1.0, sentinel) == 5);
+  BOOST_TEST(*MCL::percentile(values, 0.25, sentinel) == 1.5);
+  BOOST_TEST(std::isnan(*MCL::median(values, MCL::missing_t{ .policy = MCL::MISSING_PROPAGATE })));
+  BOOST_TEST(!MCL::median(std::span<double const>(), sentinel));
+}
+
+BOOST_AUTO_TEST_CASE(regression, *boost::unit_test::tolerance(1e-9))
+{
+  std::valarray<double> X = {1.2, 2.6, 1.6, 7.6, 6.6, 1.7, 2.0, 1.9, 4.8, 3.0 };
+  std::valarray<double> Y = {52.21, 53.12, 54.48, 55.84, 57.20, 58.57, 59.93, 61.29, 63.11, 64.47 };
+  std::pair<double, double> expected = MCL::linearRegression(X, Y);
+
+  std::vector<double> x(std::begin(X), std::end(X));
+  std::vector<double> y(std::begin(Y), std::end(Y));
+
+  x.insert(x.begin() + 3, NaN);
+  y.insert(y.begin() + 3, 1000);
+  x.push_back(100);
+  y.push_back(NaN);
+
+  std::pair<double, double> r = MCL::linearRegression(std::span<double const>(x), std::span<double const>(y), MCL::missing_t{});
+
+  BOOST_TEST(r.first == expected.first);
+  BOOST_TEST(r.second == expected.second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
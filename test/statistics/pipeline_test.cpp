@@ -0,0 +1,80 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define TEST  // Used to exclude error reporting and avoid having to link GCL + others.
+
+#include <cmath>
+#include <valarray>
+#include <vector>
+
+#include "include/functions/linearRegression.hpp"
+#include "include/statistics/pipeline.hpp"
+#include "include/statistics/stdev.hpp"
+
+BOOST_AUTO_TEST_SUITE(statistics_pipeline)
+
+BOOST_AUTO_TEST_CASE(reductions, *boost::unit_test::tolerance(1e-9))
+{
+  std::vector<double> data(10007);
+
+  for (std::size_t index = 0; index < data.size(); index++)
+  {
+    data[index] = std::sin(static_cast<double>(index)) * 100;
+  };
+
+    // stdev of log(x) for x > 0, against a filtered and transformed copy.
+
+  std::valarray<double> expected(data.size());
+  std::size_t count = 0;
+
+  for (double x : data)
+  {
+    if (x > 0)
+    {
+      expected[count++] = std::log(x);
+    };
+  };
+  expected = std::valarray<double>(expected[std::slice(0, count, 1)]);
+
+  auto logs = MCL::pipeline(data).filter([](double x) { return x > 0; }).map([](double x) { return std::log(x); });
+
+  BOOST_TEST(logs.count() == count);
+  BOOST_TEST(logs.sum() == expected.sum());
+  BOOST_TEST(*logs.mean() == expected.sum() / count);
+  BOOST_TEST(*logs.stdev() == MCL::stdev(expected));
+  BOOST_TEST(logs.minmax()->first == expected.min());
+  BOOST_TEST(logs.minmax()->second == expected.max());
+
+    // Maps may use the index.
+
+  BOOST_TEST(MCL::pipeline(data).map([](std::size_t index, double) { return static_cast<double>(index); }).sum() ==
+             10006.0 * 10007.0 / 2);
+
+    // Nothing kept.
+
+  auto none = MCL::pipeline(data).filter([](double x) { return x > 1000; });
+  BOOST_TEST(none.count() == 0);
+  BOOST_TEST(!none.mean());
+  BOOST_TEST(!none.minmax());
+  BOOST_TEST(!MCL::pipeline(std::vector<float>{}).variance());
+}
+
+BOOST_AUTO_TEST_CASE(regression, *boost::unit_test::tolerance(1e-9))
+{
+  std::valarray<double> X = {1.2, 2.6, 1.6, 7.6, 6.6, 1.7, 2.0, 1.9, 4.8, 3.0, 3.5, 4.0, 1.8, 5.6, 2.2 };
+  std::valarray<double> Y = {52.21, 53.12, 54.48, 55.84, 57.20, 58.57, 59.93, 61.29, 63.11, 64.47, 66.28, 68.10, 69.92, 72.19, 74.46};
+
+  std::pair<double, double> expected = MCL::linearRegression(X, Y);
+  std::pair<double, double> r = MCL::pipeline(X).regression([](double x) { return x; },
+                                                            [&Y](std::size_t index, double) { return Y[index]; });
+
+  BOOST_TEST(r.first == expected.first);
+  BOOST_TEST(r.second == expected.second);
+
+  MCL::coMoments_t c = MCL::pipeline(X).coMoments([](double x) { return x; },
+                                                  [&Y](std::size_t index, double) { return Y[index]; });
+  BOOST_TEST(c.count == 15);
+  BOOST_TEST(c.covariance() * c.covariance() / (c.Cxx / 14 * c.Cyy / 14) == c.correlation() * c.correlation());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,68 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "include/statistics/reproducible.hpp"
+#include "include/statistics/variance.hpp"
+#include "include/utility/executionContext.h"
+
+BOOST_AUTO_TEST_SUITE(statistics_reproducible)
+
+BOOST_AUTO_TEST_CASE(threadCountIndependent)
+{
+  std::vector<double> data(1000003);
+  std::uint64_t state = 12345;
+
+  for (auto &value : data)
+  {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    value = std::ldexp(static_cast<double>(state >> 11), -53) * std::pow(10.0, static_cast<double>(state % 7)) - 500;
+  };
+
+  MCL::executionContext_t single(1);
+  MCL::executionContext_t::scope_t scope(single);
+
+  double sum = MCL::sum_r(data.data(), data.size());
+  double mean = *MCL::mean_r(data.data(), data.size());
+  double variance = *MCL::variance_r(data.data(), data.size());
+
+  for (std::size_t threads : { 2, 3, 4, 7, 16 })
+  {
+    MCL::executionContext_t context(threads);
+    MCL::executionContext_t::scope_t inner(context);
+
+    BOOST_TEST(MCL::sum_r(data.data(), data.size()) == sum);
+    BOOST_TEST(*MCL::mean_r(data.data(), data.size()) == mean);
+    BOOST_TEST(*MCL::variance_r(data.data(), data.size()) == variance);
+  };
+
+  BOOST_TEST(variance == *MCL::variance(data.data(), data.size()), boost::test_tools::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(values)
+{
+  std::vector<std::int32_t> data = { 2, 4, 4, 4, 5, 5, 7, 9 };
+
+  BOOST_TEST(MCL::sum_r(data.data(), data.size()) == 40.0);
+  BOOST_TEST(*MCL::mean_r(data.data(), data.size()) == 5.0);
+  BOOST_TEST(*MCL::variance_r(data.data(), data.size()) == 32.0 / 7.0);
+
+  BOOST_TEST(MCL::sum_r(data.data(), 0) == 0.0);
+  BOOST_TEST(!MCL::mean_r(data.data(), 0));
+  BOOST_TEST(!MCL::variance_r(data.data(), 0));
+  BOOST_TEST(*MCL::variance_r(data.data(), 1) == 0.0);
+
+  std::vector<double> ramp(10000);
+  for (std::size_t index = 0; index < ramp.size(); index++)
+  {
+    ramp[index] = static_cast<double>(index + 1);
+  };
+
+  BOOST_TEST(MCL::sum_r(ramp.data(), ramp.size()) == 50005000.0);
+  BOOST_TEST(*MCL::variance_r(ramp.data(), ramp.size()) == 10000.0 * 10001.0 / 12, boost::test_tools::tolerance(1e-14));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,193 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <latch>
+#include <random>
+#include <stop_token>
+#include <thread>
+#include <valarray>
+#include <vector>
+
+#include "include/exceptions.h"
+#include "include/financial/xirr.h"
+#include "include/statistics/anderson-darling.hpp"
+#include "include/statistics/median.hpp"
+#include "include/utility/async.hpp"
+#include "include/utility/parallel.hpp"
+#include "include/utility/sort.hpp"
+
+namespace
+{
+    // Counts the comparisons of a sort, and requests a stop after a number of comparisons.
+
+  struct comparison_t
+  {
+    static inline std::atomic<std::size_t> count = 0;
+    static inline std::size_t stopAt = 0;
+    static inline std::stop_source *stopSource = nullptr;
+
+    std::uint64_t value;
+
+    bool operator<(comparison_t const &rhs) const noexcept
+    {
+      if ( (++count == stopAt) && stopSource )
+      {
+        stopSource->request_stop();
+      };
+      return value < rhs.value;
+    }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(utility_async)
+
+BOOST_AUTO_TEST_CASE(results, *boost::unit_test::tolerance(0.001))
+{
+  MCL::executor_t executor(2);
+  MCL::asyncOptions_t options{ .executor = &executor };
+
+  std::valarray<double> X = {1.2, 2.6, 1.6, 7.6, 6.6, 1.7, 2.0, 1.9, 4.8, 3.0, 3.5, 4.0, 1.8, 5.6, 2.2 };
+  MCL::cashflowVector_t cashflows =
+  {
+    {std::chrono::January/1/2008, -10000},
+    {std::chrono::March/1/2008, 2750},
+    {std::chrono::October/30/2008, 4250},
+    {std::chrono::February/15/2009, 3250},
+    {std::chrono::April/1/2009, 2750},
+  };
+  std::vector<MCL::goodnessOfFit_t> GOF = {{.PDF = MCL::PDF_NORMAL, .parameters{3.34, 1.98}, .alpha = 0.05 }};
+
+    // Several calls in flight at the same time.
+
+  std::future<MCL::FP_t> median = MCL::median(options, X);
+  std::future<double> rate = MCL::XIRR(options, cashflows);
+  std::future<std::vector<MCL::goodnessOfFit_t>> fit = MCL::anderson_darling_1S(options, X, GOF);
+
+  BOOST_TEST(median.get() == MCL::median(X));
+  BOOST_TEST(rate.get() == 0.3733625);
+
+  MCL::anderson_darling_1S(X, GOF);
+  BOOST_TEST(fit.get()[0].H0 == GOF[0].H0);
+
+    // Exceptions are returned through the future.
+
+  BOOST_CHECK_THROW(MCL::XIRR(options, MCL::cashflowVector_t{}).get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(cancellation)
+{
+  MCL::executor_t executor(1);
+  std::valarray<double> X(1.0, 1000);
+
+    // Stale requests are abandoned without running.
+
+  std::stop_source stopSource;
+  stopSource.request_stop();
+  BOOST_CHECK_THROW(MCL::median(MCL::asyncOptions_t{ .stopToken = stopSource.get_token(), .executor = &executor }, X).get(),
+                    MCL::operation_cancelled);
+
+  MCL::asyncOptions_t expired{ .deadline = MCL::cancellation_t::clock_t::now(), .executor = &executor };
+  BOOST_CHECK_THROW(MCL::median(expired, X).get(), MCL::deadline_exceeded);
+
+    // A running call stops at its next cancellation point.
+
+  std::stop_source running;
+  std::atomic<bool> started = false;
+  std::future<int> future = MCL::async(MCL::asyncOptions_t{ .stopToken = running.get_token(), .executor = &executor }, [&]()
+  {
+    started = true;
+    for (;;)
+    {
+      MCL::cancellationPoint();
+      std::this_thread::yield();
+    };
+    return 0;
+  });
+
+  while (!started)
+  {
+    std::this_thread::yield();
+  };
+  running.request_stop();
+  BOOST_CHECK_THROW(future.get(), MCL::operation_cancelled);
+
+  std::future<int> budget = MCL::async(MCL::asyncOptions_t{ .deadline = MCL::cancellation_t::clock_t::now() +
+                                                                         std::chrono::milliseconds(20),
+                                                            .executor = &executor }, []()
+  {
+    for (;;)
+    {
+      MCL::cancellationPoint();
+      std::this_thread::yield();
+    };
+    return 0;
+  });
+  BOOST_CHECK_THROW(budget.get(), MCL::deadline_exceeded);
+
+    // Without a cancellation the cancellation point does nothing.
+
+  BOOST_CHECK_NO_THROW(MCL::cancellationPoint());
+}
+
+BOOST_AUTO_TEST_CASE(cancelSort)
+{
+  MCL::executionContext_t context(2);
+  MCL::executionContext_t::scope_t contextScope(context);
+  std::vector<comparison_t> values(std::size_t{1} << 20);
+  std::mt19937_64 generator(1);
+
+  for (comparison_t &value : values)
+  {
+    value.value = generator();
+  };
+
+  std::vector<comparison_t> copy = values;
+
+  comparison_t::count = 0;
+  MCL::sort(copy.begin(), copy.end());
+  std::size_t full = comparison_t::count;
+
+    // A stop is requested after a few comparisons. The helper thread of the sort is cancelled with the calling thread, so the
+    // sort stops well before it is complete. (The comparisons are counted rather than timed.)
+
+  std::stop_source stopSource;
+  MCL::cancellation_t cancellation(stopSource.get_token());
+  MCL::cancellation_t::scope_t cancellationScope(cancellation);
+
+  comparison_t::count = 0;
+  comparison_t::stopAt = 1000;
+  comparison_t::stopSource = &stopSource;
+
+  BOOST_CHECK_THROW(MCL::sort(values.begin(), values.end()), MCL::operation_cancelled);
+  BOOST_TEST(comparison_t::count < full / 4);
+
+  comparison_t::stopSource = nullptr;
+}
+
+BOOST_AUTO_TEST_CASE(executor)
+{
+  MCL::executor_t executor(2);
+  std::latch latch(2);
+  MCL::asyncOptions_t options{ .executor = &executor };
+
+    // Both tasks must run at the same time to pass the latch.
+
+  std::future<void> a = MCL::async(options, [&]() { latch.arrive_and_wait(); });
+  std::future<void> b = MCL::async(options, [&]() { latch.arrive_and_wait(); });
+
+  BOOST_CHECK_NO_THROW(a.get());
+  BOOST_CHECK_NO_THROW(b.get());
+  BOOST_TEST(executor.size() == 2);
+
+    // Tasks run in the execution context of the caller.
+
+  MCL::executionContext_t context(3);
+  MCL::executionContext_t::scope_t scope(context);
+
+  BOOST_TEST(MCL::async(options, []() { return MCL::threadCount(1000000); }).get() == 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "include/utility/executionContext.h"
+#include "include/utility/parallel.hpp"
+#include "include/utility/sort.hpp"
+
+namespace
+{
+    // Records whether the comparisons of a sort are made in the expected execution context.
+
+  struct probe_t
+  {
+    static inline MCL::executionContext_t const *expected = nullptr;
+    static inline std::atomic<bool> outOfContext = false;
+
+    int value;
+
+    bool operator<(probe_t const &rhs) const noexcept
+    {
+      if (MCL::executionContext_t::current() != expected)
+      {
+        outOfContext = true;
+      };
+      return value < rhs.value;
+    }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(utility_executionContext)
+
+BOOST_AUTO_TEST_CASE(cgroup)
+{
+  BOOST_TEST(*MCL::detail::cgroupV2Limit("400000 100000") == 4);
+  BOOST_TEST(*MCL::detail::cgroupV2Limit("150000 100000\n") == 2);
+  BOOST_TEST(!MCL::detail::cgroupV2Limit("max 100000"));
+  BOOST_TEST(!MCL::detail::cgroupV2Limit("garbage"));
+  BOOST_TEST(*MCL::detail::cgroupV1Limit(50000, 100000) == 1);
+  BOOST_TEST(!MCL::detail::cgroupV1Limit(-1, 100000));
+
+  std::size_t available = MCL::availableConcurrency();
+  BOOST_TEST(available >= 1);
+  BOOST_TEST(available <= std::max(1U, std::thread::hardware_concurrency()));
+}
+
+BOOST_AUTO_TEST_CASE(context)
+{
+  MCL::executionContext_t outer(3);
+  MCL::executionContext_t inner(2);
+
+  BOOST_TEST(MCL::executionContext_t::current() == nullptr);
+
+  {
+    MCL::executionContext_t::scope_t scope1(outer);
+
+    BOOST_TEST(MCL::threadCount(100000) == 3);
+
+    {
+      MCL::executionContext_t::scope_t scope2(inner);
+      BOOST_TEST(MCL::threadCount(100000) == 2);
+    };
+
+    BOOST_TEST(MCL::executionContext_t::current() == &outer);
+
+      // Worker threads run in the context of the calling thread.
+
+    std::atomic<int> inContext = 0;
+    std::size_t threads = MCL::parallelFor(100000, [&](std::size_t, std::size_t, std::size_t)
+    {
+      inContext += (MCL::executionContext_t::current() == &outer) ? 1 : 0;
+    });
+
+    BOOST_TEST(threads == 3);
+    BOOST_TEST(inContext == 3);
+  };
+
+  BOOST_TEST(MCL::executionContext_t::current() == nullptr);
+  BOOST_TEST(MCL::executionContext_t(0).maxThreads() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(fixedThreadCount)
+{
+  MCL::executionContext_t context(3);
+  MCL::executionContext_t::scope_t scope(context);
+
+    // The number of blocks is the value passed, not the (current) thread limit.
+
+  std::vector<int> blocks(5, 0);
+  std::size_t threads = MCL::parallelFor(100000, blocks.size(), [&](std::size_t, std::size_t, std::size_t threadNumber)
+  {
+    blocks[threadNumber]++;
+  });
+
+  BOOST_TEST(threads == 5);
+  BOOST_TEST(blocks == std::vector<int>(5, 1));
+  BOOST_TEST(MCL::parallelFor(10, 0, [](std::size_t, std::size_t, std::size_t) {}) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(sort)
+{
+  MCL::executionContext_t context(2);
+  MCL::executionContext_t::scope_t scope(context);
+  std::vector<probe_t> values(100000);
+
+  for (std::size_t index = 0; index < values.size(); index++)
+  {
+    values[index].value = static_cast<int>((index * 7919) % values.size());
+  };
+
+  probe_t::expected = &context;
+  MCL::sort(values.begin(), values.end());
+
+  BOOST_TEST(!probe_t::outOfContext);
+  BOOST_TEST(std::is_sorted(values.begin(), values.end()));
+}
+
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE(pinning)
+{
+  cpu_set_t mask;
+
+  BOOST_REQUIRE(::sched_getaffinity(0, sizeof(mask), &mask) == 0);
+
+  int cpu = 0;
+  while (!CPU_ISSET(cpu, &mask))
+  {
+    cpu++;
+  };
+
+  MCL::executionContext_t context(2, { cpu });
+  MCL::executionContext_t::scope_t scope(context);
+  std::atomic<int> pinned = 0;
+
+  MCL::parallelFor(2, [&](std::size_t, std::size_t, std::size_t threadNumber)
+  {
+    if (threadNumber == 0)
+    {
+      cpu_set_t workerMask;
+
+      ::sched_getaffinity(0, sizeof(workerMask), &workerMask);
+      pinned = (CPU_COUNT(&workerMask) == 1) && CPU_ISSET(cpu, &workerMask);
+    };
+  }, 1);
+
+  BOOST_TEST(pinned == 1);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,125 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/utility/instrument.h"
+
+namespace
+{
+  MCL::instrument::kernelStats_t find(char const *name)
+  {
+    for (MCL::instrument::kernelStats_t const &k : MCL::instrument::snapshot())
+    {
+      if (k.name == name)
+      {
+        return k;
+      };
+    };
+    return MCL::instrument::kernelStats_t{};
+  }
+
+  void countEvents(MCL::instrument::event_t const &event, void *context)
+  {
+    if (std::string(event.name) == "test.callback")
+    {
+      (*static_cast<int *>(context))++;
+    };
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(utility_instrument)
+
+BOOST_AUTO_TEST_CASE(counters)
+{
+  std::size_t id = MCL::instrument::registerKernel("test.kernel");
+
+  BOOST_TEST(MCL::instrument::registerKernel("test.kernel") == id);
+
+  MCL::instrument::reset();
+
+  {
+    MCL::instrument::scope_t scope(id, 100, 800);
+    MCL::instrument::threadsUsed(4);
+  };
+
+    // Scopes recorded on other threads are included, also after the thread has exited.
+
+  std::thread thread([id]()
+  {
+    MCL::instrument::scope_t scope(id, 50, 400);
+  });
+  thread.join();
+
+  MCL::instrument::kernelStats_t k = find("test.kernel");
+
+  BOOST_TEST(k.calls == 2);
+  BOOST_TEST(k.elements == 150);
+  BOOST_TEST(k.bytes == 1200);
+  BOOST_TEST(k.threads == 5);
+
+  std::string json = MCL::instrument::toJSON();
+  BOOST_TEST(json.find("{\"name\":\"test.kernel\",\"calls\":2,\"elements\":150,\"bytes\":1200,\"threads\":5") !=
+             std::string::npos);
+
+  MCL::instrument::reset();
+  BOOST_TEST(find("test.kernel").calls == 0);
+}
+
+BOOST_AUTO_TEST_CASE(trace)
+{
+  std::size_t outer = MCL::instrument::registerKernel("test.outer");
+  std::size_t inner = MCL::instrument::registerKernel("test.inner");
+
+  MCL::instrument::reset();
+
+  {
+    MCL::instrument::scope_t scope(outer, 10, 80);
+    BOOST_TEST(MCL::instrument::scope_t::current() == &scope);
+  };
+  BOOST_TEST(MCL::instrument::events().empty());
+
+  MCL::instrument::enableTrace(true);
+  {
+    MCL::instrument::scope_t scope1(outer, 10, 80);
+    MCL::instrument::scope_t scope2(inner);
+  };
+  MCL::instrument::enableTrace(false);
+
+  std::vector<MCL::instrument::event_t> events = MCL::instrument::events();
+
+  BOOST_REQUIRE(events.size() == 2);
+  BOOST_TEST(std::string(events[0].name) == "test.outer");
+  BOOST_TEST(std::string(events[1].name) == "test.inner");
+  BOOST_TEST(events[0].elements == 10);
+  BOOST_TEST(events[0].duration >= events[1].duration);
+  BOOST_TEST(MCL::instrument::scope_t::current() == nullptr);
+
+  std::string trace = MCL::instrument::toChromeTrace();
+  BOOST_TEST(trace.find("{\"traceEvents\":[{\"name\":\"test.outer\",\"ph\":\"X\"") == 0);
+  BOOST_TEST(trace.find("\"args\":{\"elements\":10,\"bytes\":80,\"threads\":1}") != std::string::npos);
+
+  MCL::instrument::reset();
+  BOOST_TEST(MCL::instrument::events().empty());
+}
+
+BOOST_AUTO_TEST_CASE(callback)
+{
+  std::size_t id = MCL::instrument::registerKernel("test.callback");
+  int calls = 0;
+
+  MCL::instrument::setCallback(countEvents, &calls);
+  {
+    MCL::instrument::scope_t scope(id);
+  };
+  MCL::instrument::setCallback(nullptr);
+  {
+    MCL::instrument::scope_t scope(id);
+  };
+
+  BOOST_TEST(calls == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
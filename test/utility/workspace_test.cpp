@@ -0,0 +1,169 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define TEST  // Used to exclude error reporting and avoid having to link GCL + others.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <valarray>
+#include <vector>
+
+#include "include/financial/xirr.h"
+#include "include/statistics/anderson-darling.hpp"
+#include "include/statistics/distributionFunctions/weibull.hpp"
+#include "include/statistics/mean.hpp"
+#include "include/statistics/median.hpp"
+#include "include/statistics/minmax.hpp"
+#include "include/statistics/sum.hpp"
+#include "include/statistics/variance.hpp"
+#include "include/utility/workspace.hpp"
+
+  // Counts the allocations made through the global operator new. (The replacement applies to the whole test program.)
+
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+static std::atomic<std::size_t> allocations = 0;
+
+void *operator new(std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+
+  if (void *p = std::malloc(size == 0 ? 1 : size))
+  {
+    return p;
+  };
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+BOOST_AUTO_TEST_SUITE(utility_workspace)
+
+BOOST_AUTO_TEST_CASE(allocate)
+{
+  MCL::workspace_t workspace;
+
+  std::span<char> c = workspace.allocate<char>(3);
+  std::span<double> d;
+
+  {
+    MCL::workspace_t::scope_t scope(workspace);
+
+    d = workspace.allocate<double>(10);
+    BOOST_TEST(reinterpret_cast<std::uintptr_t>(d.data()) % alignof(double) == 0);
+    BOOST_TEST(reinterpret_cast<std::uintptr_t>(d.data()) >= reinterpret_cast<std::uintptr_t>(c.data() + c.size()));
+  };
+
+  {
+    MCL::workspace_t::scope_t scope(workspace);
+
+    BOOST_TEST(workspace.allocate<double>(10).data() == d.data());     // Released memory is reused.
+
+    std::size_t capacity = workspace.capacity();
+    std::span<std::uint8_t> large = workspace.allocate<std::uint8_t>(capacity);
+
+    BOOST_TEST(large.size() == capacity);
+    BOOST_TEST(workspace.capacity() > capacity);
+  };
+
+  BOOST_TEST(workspace.allocate<int>(0).empty());
+  BOOST_TEST(MCL::workspace_t(100000).capacity() == 100000);
+}
+
+BOOST_AUTO_TEST_CASE(trim)
+{
+  MCL::workspace_t workspace;
+
+    // Small blocks are kept, large blocks are freed when the outermost scope ends.
+
+  {
+    MCL::workspace_t::scope_t outer(workspace);
+    workspace.allocate<double>(100);
+
+    {
+      MCL::workspace_t::scope_t inner(workspace);
+      workspace.allocate<double>(std::size_t{1} << 22);
+    };
+
+    BOOST_TEST(workspace.capacity() > (std::size_t{1} << 25));     // Still in the outer scope.
+  };
+
+  BOOST_TEST(workspace.capacity() != 0);
+  BOOST_TEST(workspace.capacity() <= (std::size_t{1} << 24));
+
+  workspace.trim();
+  BOOST_TEST(workspace.capacity() == 0);
+
+    // Blocks that hold arrays are not freed.
+
+  std::span<int> held = workspace.allocate<int>(10);
+  workspace.trim();
+  BOOST_TEST(workspace.capacity() != 0);
+  held[9] = 1;
+
+    // A reserved size is retained.
+
+  MCL::workspace_t reserved(std::size_t{1} << 25);
+  {
+    MCL::workspace_t::scope_t scope(reserved);
+    reserved.allocate<std::byte>(std::size_t{1} << 25);
+  };
+  BOOST_TEST(reserved.capacity() == (std::size_t{1} << 25));
+}
+
+BOOST_AUTO_TEST_CASE(steadyState)
+{
+  std::size_t savedThreads = MCL::maxThreads;
+  MCL::maxThreads = 1;
+
+  std::valarray<double> va(200);
+  for (std::size_t index = 0; index < va.size(); index++)
+  {
+    va[index] = 1.0 + static_cast<double>((index * 37) % 101) / 10.0;
+  };
+
+  std::vector<double> v(std::begin(va), std::end(va));
+  std::vector<MCL::goodnessOfFit_t> GOF = { { .PDF = MCL::PDF_NORMAL, .parameters{ 5.0, 3.0 }, .alpha = 0.05 } };
+  MCL::cashflowVector_t cashflows = { { std::chrono::January/1/2017, -1000 }, { std::chrono::July/1/2017, -1000 },
+                                      { std::chrono::January/1/2018, 2200 } };
+  MCL::FP_t result = 0;
+
+  auto run = [&]()
+  {
+    result += *MCL::mean(v.data(), v.size());
+    result += MCL::mean(va);
+    result += *MCL::variance(v.data(), v.size());
+    result += MCL::variance(va);
+    result += MCL::sum(va);
+    result += *MCL::max(va) - *MCL::min(va);
+    result += MCL::minmax(va).second + std::get<0>(*MCL::minmax(v.data(), v.size()));
+    result += MCL::median(va) + MCL::median(v);
+    result += MCL::weibull_regression(va).first;
+    result += MCL::XIRR(cashflows);
+    MCL::anderson_darling_1S(va, GOF);
+  };
+
+  run();      // The first call sizes the workspace.
+
+  std::size_t before = allocations.load();
+  run();
+  std::size_t after = allocations.load();
+
+  MCL::maxThreads = savedThreads;
+
+  BOOST_TEST(after == before);
+  BOOST_TEST(result != 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+﻿#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "include/vector3DArray.hpp"
+
+BOOST_AUTO_TEST_SUITE(vector3DArray)
+
+BOOST_AUTO_TEST_CASE(conversion)
+{
+  std::vector<MCL::TVector3D<double>> aos = { { 1, 2, 3 }, { -4, 5, -6 } };
+  MCL::vector3DArray_t<double> soa(aos);
+
+  BOOST_TEST(soa.size() == 2);
+  BOOST_TEST(soa.x()[1] == -4.0);
+  BOOST_TEST(soa.z()[0] == 3.0);
+
+  soa.push_back(MCL::TVector3D<double>(7, 8, 9));
+  BOOST_TEST(soa.at(2).y() == 8.0);
+  BOOST_CHECK_THROW(soa.at(3), std::out_of_range);
+
+  std::vector<MCL::TVector3D<double>> back(3);
+  soa.toAoS(back);
+  BOOST_TEST(back[1].x() == -4.0);
+  BOOST_TEST(back[2].z() == 9.0);
+
+  std::vector<MCL::TVector3D<double>> small(1);
+  BOOST_CHECK_THROW(soa.toAoS(small), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(products)
+{
+  std::size_t const count = 50000;
+  MCL::vector3DArray_t<double> a(count), b(count), c;
+  std::vector<double> d(count);
+
+  for (std::size_t index = 0; index < count; index++)
+  {
+    a.set(index, MCL::TVector3D<double>(index * 0.5, 1.0, -2.0));
+    b.set(index, MCL::TVector3D<double>(3.0, index * 0.25, 1.5));
+  };
+
+  a.dot(b, d);
+  a.cross(b, c);
+
+  for (std::size_t index = 0; index < count; index += 997)
+  {
+    MCL::TVector3D<double> va = a.at(index), vb = b.at(index);
+    MCL::TVector3D<double> vc = va.cross(vb);
+
+    BOOST_TEST(d[index] == va.dot(vb));
+    BOOST_TEST(c.x()[index] == vc.x());
+    BOOST_TEST(c.y()[index] == vc.y());
+    BOOST_TEST(c.z()[index] == vc.z());
+  };
+
+  a.cross(b, a);
+  BOOST_TEST(a.at(1000).x() == c.at(1000).x());
+
+  BOOST_CHECK_THROW(a.dot(MCL::vector3DArray_t<double>(1), d), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(lengths)
+{
+  MCL::vector3DArray_t<double> a(20000);
+  std::vector<double> l(a.size());
+
+  for (std::size_t index = 0; index < a.size(); index++)
+  {
+    a.set(index, MCL::TVector3D<double>(3.0 * (index + 1), 4.0 * (index + 1), 0.0));
+  };
+
+  a.length(l);
+  BOOST_TEST(l[0] == 5.0);
+  BOOST_TEST(l[9] == 50.0);
+
+  a.normalise();
+  a.length(l);
+  for (std::size_t index = 0; index < a.size(); index += 101)
+  {
+    BOOST_TEST(l[index] == 1.0, boost::test_tools::tolerance(1e-15));
+  };
+  BOOST_TEST(a.x()[5] == 0.6, boost::test_tools::tolerance(1e-15));
+}
+
+BOOST_AUTO_TEST_CASE(rounding)
+{
+  std::vector<MCL::TVector3D<double>> aos = { { 1.5, -1.5, 2.0 } };
+  MCL::vector3DArray_t<double> a(aos), b(aos);
+
+  a.floor();
+  b.ceil();
+
+  BOOST_TEST(a.x()[0] == 1.0);
+  BOOST_TEST(a.y()[0] == -2.0);
+  BOOST_TEST(b.x()[0] == 2.0);
+  BOOST_TEST(b.y()[0] == -1.0);
+  BOOST_TEST(b.z()[0] == 2.0);
+}
+
+BOOST_AUTO_TEST_CASE(transform)
+{
+  std::vector<MCL::TVector3D<double>> aos = { { 1, 0, 0 }, { 1, 2, 3 } };
+  MCL::vector3DArray_t<double> a(aos);
+
+    // Rotation of 90 degrees about the z axis.
+
+  a.transform({{ {{ 0, -1, 0 }}, {{ 1, 0, 0 }}, {{ 0, 0, 1 }} }});
+
+  BOOST_TEST(a.at(0).x() == 0.0);
+  BOOST_TEST(a.at(0).y() == 1.0);
+  BOOST_TEST(a.at(1).x() == -2.0);
+  BOOST_TEST(a.at(1).y() == 1.0);
+  BOOST_TEST(a.at(1).z() == 3.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()